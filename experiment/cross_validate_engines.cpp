@@ -0,0 +1,92 @@
+// cross_validate_engines.cpp
+// Runs every recognition engine on a graph and checks that their verdicts agree
+/*
+// Compile Command:
+clang++ -std=c++20 -O3 -o experiment/cross_validate_engines experiment/cross_validate_engines.cpp \
+    src/is_perfect_algo.cpp src/clique_cutset.cpp src/hole_writer.cpp src/utils.cpp -Iinclude -lpthread
+*/
+
+#include "is_perfect_algo.h"
+#include "utils.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: cross_validate_engines GRAPH_FILE CSV_FILE\n";
+        return 1;
+    }
+    std::string path = argv[1];
+
+    auto adj = read_graph_adj_matrix_from_file(path);
+
+    const Recognition_Engine engines[] = {Recognition_Engine::path_dfs, Recognition_Engine::decomposition,
+                                          Recognition_Engine::race, Recognition_Engine::automatic};
+    const int n_engines = 4;
+    long long runtimes[n_engines];
+    bool verdicts[n_engines];
+
+    for (int e = 0; e < n_engines; ++e)
+    {
+        auto time_start = std::chrono::high_resolution_clock::now();
+        verdicts[e] = is_perfect(adj, engines[e]);
+        auto time_end = std::chrono::high_resolution_clock::now();
+        runtimes[e] = std::chrono::duration_cast<std::chrono::milliseconds>(time_end - time_start).count();
+    }
+
+    bool is_consistent = true;
+    for (int e = 1; e < n_engines; ++e)
+    {
+        if (verdicts[e] != verdicts[0])
+            is_consistent = false;
+    }
+
+    // Summary Output to experiment csv
+    std::ofstream experiment_csv_file;
+    experiment_csv_file.open(argv[2], std::ios::app);
+    if (!experiment_csv_file)
+    {
+        std::cerr << "Error opening experiment_csv_file." << std::endl;
+        return 1;
+    }
+
+    Graph_File_Info graph_file_info_obj;
+    parse_graph_detail(path, graph_file_info_obj);
+
+    // Write column names only if the file is empty
+    if (experiment_csv_file.tellp() == 0)
+    {
+        experiment_csv_file << "graph_path,type,order,density,id,runtime_dfs,is_perfect_dfs"
+                               ",runtime_decomposition,is_perfect_decomposition,runtime_race,is_perfect_race"
+                               ",runtime_auto,is_perfect_auto,is_consistent"
+                            << std::endl;
+    }
+
+    std::string summary;
+    summary += path + ",";
+    summary += graph_file_info_obj.type + ",";
+    summary += graph_file_info_obj.order + ",";
+    summary += graph_file_info_obj.density + ",";
+    summary += graph_file_info_obj.id + ",";
+    for (int e = 0; e < n_engines; ++e)
+    {
+        summary += std::to_string(runtimes[e]) + ",";
+        summary += std::to_string(verdicts[e]) + ",";
+    }
+    summary += std::to_string(is_consistent);
+
+    experiment_csv_file << summary << std::endl;
+
+    experiment_csv_file.close();
+
+    if (!is_consistent)
+    {
+        std::cerr << "Engines disagree on " << path << std::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -4,7 +4,8 @@
 /*
 // Compile Command:
 clang++ -std=c++20 -O3 -o experiment/is_perfect_experiment experiment/is_perfect_experiment.cpp \
-    src/is_perfect_algo.cpp src/utils.cpp -Iinclude -I/usr/local/include/igraph -L/usr/local/lib \
+    src/is_perfect_algo.cpp src/clique_cutset.cpp src/hole_writer.cpp src/utils.cpp -Iinclude \
+    -I/usr/local/include/igraph -L/usr/local/lib \
     -L/opt/homebrew/lib -ligraph -larpack -llapack -lblas -lm -lpthread
 */
 
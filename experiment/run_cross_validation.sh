@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# Parameters
+INPUTS_DIR="/Users/burakerdem/graphs/is_perfect_test3"
+OUTPUTS_DIR="outputs"
+SUMMARY_FILE="$OUTPUTS_DIR/cross_validation.csv"
+
+mkdir -p "$OUTPUTS_DIR"
+
+N_MISMATCHES=0
+for input_file in "$INPUTS_DIR"/*; do
+    ./experiment/cross_validate_engines "$input_file" "$SUMMARY_FILE" || N_MISMATCHES=$((N_MISMATCHES + 1))
+done
+echo "Graphs with mismatching verdicts: $N_MISMATCHES"
@@ -0,0 +1,12 @@
+// clique_cutset.h
+// Decomposition of a graph by clique minimal separators
+
+#pragma once
+
+#include <vector>
+
+// Returns the atoms of the clique minimal separator decomposition of the graph, given by its adjacency
+// lists, as sorted vertex lists. Atoms have no clique cutset and every induced subgraph without a
+// clique cutset, such as a hole or an antihole, lies within one atom. A graph without a clique cutset
+// is its only atom. Runs in O(nm).
+std::vector<std::vector<int>> get_clique_cutset_atoms(const std::vector<std::vector<int>> &graph_adj_list);
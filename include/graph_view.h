@@ -0,0 +1,155 @@
+// graph_view.h
+// Non-owning views over graphs held in the caller's memory
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A graph view provides size(), is_adjacent(i, j) and append_neighbors(v, neighbors), which appends the
+// neighbors of v in increasing order. Views do not own the graph, and the graph should stay alive and
+// unchanged while a view is in use. Graphs are expected to be simple: symmetric with no loops.
+
+// The adjacency matrix used by the program
+struct Adjacency_Matrix_View
+{
+    const std::vector<std::vector<bool>> *adj_mat;
+
+    int size() const
+    {
+        return adj_mat->size();
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return (*adj_mat)[i][j];
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        for (int j = 0; j < size(); ++j)
+        {
+            if ((*adj_mat)[v][j])
+                neighbors.push_back(j);
+        }
+    }
+};
+
+// Bit j of row i is bit (j % 64) of bits[i * row_stride + j / 64]. row_stride is in 64 bit words and is
+// at least (n + 63) / 64.
+struct Packed_Bits_View
+{
+    const uint64_t *bits;
+    int n;
+    size_t row_stride;
+
+    int size() const
+    {
+        return n;
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return (bits[i * row_stride + (j >> 6)] >> (j & 63)) & 1;
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        const uint64_t *row = bits + v * row_stride;
+        for (int word_id = 0; word_id * 64 < n; ++word_id)
+        {
+            // Bits past n in the last word are ignored
+            uint64_t word = row[word_id];
+            if ((word_id + 1) * 64 > n)
+                word &= (uint64_t(1) << (n - word_id * 64)) - 1;
+
+            while (word != 0)
+            {
+                neighbors.push_back(word_id * 64 + std::countr_zero(word));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+// Entry (i, j) is matrix[i * row_stride + j], a nonzero byte is an edge. row_stride is at least n.
+struct Byte_Matrix_View
+{
+    const uint8_t *matrix;
+    int n;
+    size_t row_stride;
+
+    int size() const
+    {
+        return n;
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return matrix[i * row_stride + j] != 0;
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        const uint8_t *row = matrix + v * row_stride;
+        for (int j = 0; j < n; ++j)
+        {
+            if (row[j] != 0)
+                neighbors.push_back(j);
+        }
+    }
+};
+
+// Neighbors of v are column_indices[row_offsets[v]] to column_indices[row_offsets[v + 1] - 1], sorted in
+// increasing order. Adjacency is tested with a binary search in the row.
+struct Csr_View
+{
+    const int32_t *row_offsets;
+    const int32_t *column_indices;
+    int n;
+
+    int size() const
+    {
+        return n;
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return std::binary_search(column_indices + row_offsets[i], column_indices + row_offsets[i + 1], j);
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        neighbors.insert(neighbors.end(), column_indices + row_offsets[v], column_indices + row_offsets[v + 1]);
+    }
+};
+
+// Complement of another view, without building it
+template <typename Graph_View>
+struct Complement_View
+{
+    Graph_View graph;
+
+    int size() const
+    {
+        return graph.size();
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return i != j && !graph.is_adjacent(i, j);
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        for (int j = 0; j < size(); ++j)
+        {
+            if (is_adjacent(v, j))
+                neighbors.push_back(j);
+        }
+    }
+};
+
+template <typename Graph_View>
+std::vector<std::vector<int>> get_adj_list_from_view(const Graph_View &graph)
+{
+    std::vector<std::vector<int>> graph_adj_list(graph.size());
+    for (int v = 0; v < graph.size(); ++v)
+    {
+        graph.append_neighbors(v, graph_adj_list[v]);
+    }
+    return graph_adj_list;
+}
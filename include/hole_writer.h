@@ -0,0 +1,68 @@
+// hole_writer.h
+// Streaming output of odd holes and odd antiholes
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum class Hole_Output_Format
+{
+    // Same listing as the console output, one cycle per line
+    text,
+    // One JSON object per line, for each cycle and for each graph
+    json_lines,
+    // Little-endian records, see README for the layout
+    binary
+};
+
+// Holes are appended to a large buffer as they are found, and the buffer is written to the stream
+// when it is full. Nothing is kept once written, so memory does not grow with the number of holes.
+class Hole_Writer
+{
+  public:
+    Hole_Writer(std::ostream &stream, Hole_Output_Format format, size_t buffer_size = 1 << 20);
+    ~Hole_Writer();
+
+    Hole_Writer(const Hole_Writer &) = delete;
+    Hole_Writer &operator=(const Hole_Writer &) = delete;
+
+    // Records of a graph are written between begin_graph and end_graph. Graphs do not interleave.
+    void begin_graph(const std::string &graph_path);
+    void end_graph(bool is_perfect);
+
+    // Holes (or antiholes) of the current graph are written between begin_holes and end_holes.
+    // end_holes returns the number of cycles written in the section.
+    void begin_holes(bool is_anti);
+    void write_hole(const std::vector<int> &cycle);
+    unsigned long long end_holes();
+
+    void flush();
+
+    // True once a write to the stream has failed. Later records are dropped.
+    bool has_failed() const;
+
+  private:
+    void write_buffer();
+    void reserve(size_t n_bytes);
+    void put(char c);
+    void put(const std::string &str);
+    void put_int(unsigned long long value);
+    void put_le(uint64_t value, int n_bytes);
+
+    std::ostream &stream;
+    Hole_Output_Format format;
+    std::vector<char> buffer;
+    size_t buffer_used = 0;
+    bool is_write_failed = false;
+
+    // Graph path, already escaped for JSON in json_lines format
+    std::string graph_name;
+    bool is_anti_section = false;
+    unsigned long long n_section_holes = 0;
+    unsigned long long n_odd_holes = 0;
+    unsigned long long n_odd_antiholes = 0;
+};
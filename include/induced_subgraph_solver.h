@@ -0,0 +1,77 @@
+// induced_subgraph_solver.h
+// Perfection queries over many induced subgraphs of one host graph
+
+#pragma once
+
+#include "graph_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+// The host graph is stored once as packed bit rows. A query G[S] numbers the vertices of S in the
+// order of the host and copies G[S] into compact |S| x |S| bit rows, so its cost depends on |S| and
+// not on the order of the host. G[S] is decided by the automatic engine of is_perfect_algo.h, so the
+// decomposition and its exact tests apply to the queries as well.
+//
+// Odd holes and odd antiholes found by the queries are kept as witnesses. A witness of G[S] is an
+// induced subgraph of G, so any later query S' containing its vertices is answered from the cache.
+// The cache keeps the latest max_cached_witnesses distinct witnesses.
+//
+// Queries can be made from several threads at the same time.
+class Induced_Subgraph_Solver
+{
+  public:
+    explicit Induced_Subgraph_Solver(const std::vector<std::vector<bool>> &graph_adj_mat);
+    explicit Induced_Subgraph_Solver(const Packed_Bits_View &graph);
+
+    // subset[v] tells whether vertex v is in S, subset has the order of the host graph
+    bool is_perfect(const std::vector<bool> &subset);
+
+    // Also stores a witness of non-perfection, the vertices of an odd hole (is_antihole false) or an odd
+    // antihole (is_antihole true) of G[S] along the cycle in G or in its complement
+    bool is_perfect(const std::vector<bool> &subset, std::vector<int> &witness, bool &is_antihole);
+
+    // Answers the queries on n_threads threads, all available threads if n_threads is 0
+    std::vector<bool> is_perfect_batch(const std::vector<std::vector<bool>> &subsets, int n_threads = 0);
+
+    int size() const
+    {
+        return n;
+    }
+    size_t n_cached_witnesses() const;
+
+    static constexpr size_t max_cached_witnesses = 1024;
+
+  private:
+    struct Witness
+    {
+        std::vector<int> cycle;
+        // Vertices of the cycle in increasing order, to find duplicates
+        std::vector<int> sorted_vertices;
+        bool is_antihole;
+    };
+
+    void init_rows(const Packed_Bits_View &graph);
+    bool is_adjacent(int i, int j) const
+    {
+        return (graph_rows[i * row_stride + (j >> 6)] >> (j & 63)) & 1;
+    }
+    bool is_perfect_subgraph(
+        const std::vector<int> &subset_vertices, std::vector<int> &witness, bool &is_antihole
+    ) const;
+    bool find_cached_witness(
+        const std::vector<bool> &subset, std::vector<int> &witness, bool &is_antihole
+    ) const;
+    void cache_witness(const std::vector<int> &cycle, bool is_antihole);
+
+    int n;
+    size_t row_stride;
+    std::vector<uint64_t> graph_rows;
+
+    mutable std::shared_mutex witness_mutex;
+    std::vector<Witness> witnesses;
+    // Slot replaced by the next witness once the cache is full
+    size_t next_replaced_witness = 0;
+};
@@ -3,9 +3,103 @@
 
 #pragma once
 
+#include "graph_view.h"
+#include "hole_writer.h"
+
 #include <string>
 #include <vector>
 
-bool is_perfect(const std::vector<std::vector<bool>> &graph_adj_mat);
+// Algorithms used to enumerate all odd holes and odd antiholes
+enum class Hole_Enumeration_Engine
+{
+    // Depth-first search over chordless paths, holes found from both directions are deduplicated
+    path_dfs,
+    // Output-sensitive chordless cycle enumeration, each hole is generated exactly once
+    chordless_cycles
+};
+
+// Algorithms used to recognize perfect graphs. All of them are exact, and none of them runs in polynomial
+// time on every graph.
+enum class Recognition_Engine
+{
+    // Picks one of the engines below from the order and size of the graph and from a probe of the DFS
+    automatic,
+    // Depth-first search for an odd hole in the graph and in its complement
+    path_dfs,
+    // Clique cutset decomposition of the graph and of its complement. Prime atoms are settled by
+    // bipartiteness and triangle tests when possible, and by the DFS otherwise.
+    decomposition,
+    // Runs path_dfs and decomposition on two threads, the first verdict is returned
+    race
+};
+
+bool is_perfect(
+    const std::vector<std::vector<bool>> &graph_adj_mat,
+    Recognition_Engine engine = Recognition_Engine::automatic
+);
+
+// The overloads on views read the caller's memory, see graph_view.h. The searches keep adjacency lists of
+// the graph, O(n + m) ints, and read the complement from rows of bits: in place for a Packed_Bits_View and
+// from one packed copy of n^2 / 8 bytes otherwise. The decomposition builds adjacency lists of each side it
+// splits, O(n^2) ints on a dense side.
+bool is_perfect(const Packed_Bits_View &graph, Recognition_Engine engine = Recognition_Engine::automatic);
+bool is_perfect(const Byte_Matrix_View &graph, Recognition_Engine engine = Recognition_Engine::automatic);
+bool is_perfect(const Csr_View &graph, Recognition_Engine engine = Recognition_Engine::automatic);
+
+// Also stores a witness of non-perfection, the vertices of the odd hole (is_antihole false) or odd antihole
+// (is_antihole true) that settled the verdict, along the cycle in the graph or in its complement
+bool is_perfect(
+    const Packed_Bits_View &graph,
+    std::vector<int> &witness,
+    bool &is_antihole,
+    Recognition_Engine engine = Recognition_Engine::automatic
+);
+
+bool is_perfect_log_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat,
+    std::string &log,
+    Hole_Enumeration_Engine engine = Hole_Enumeration_Engine::path_dfs
+);
+
+// Streams odd holes and odd antiholes to hole_writer as they are found, each one exactly once
+bool is_perfect_write_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat,
+    Hole_Writer &hole_writer,
+    Hole_Enumeration_Engine engine = Hole_Enumeration_Engine::path_dfs
+);
+bool is_perfect_write_holes(
+    const Packed_Bits_View &graph,
+    Hole_Writer &hole_writer,
+    Hole_Enumeration_Engine engine = Hole_Enumeration_Engine::path_dfs
+);
+bool is_perfect_write_holes(
+    const Byte_Matrix_View &graph,
+    Hole_Writer &hole_writer,
+    Hole_Enumeration_Engine engine = Hole_Enumeration_Engine::path_dfs
+);
+bool is_perfect_write_holes(
+    const Csr_View &graph, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine = Hole_Enumeration_Engine::path_dfs
+);
 
-bool is_perfect_log_holes(const std::vector<std::vector<bool>> &graph_adj_mat, std::string &log);
\ No newline at end of file
+// Counts odd holes and odd antiholes without storing them. Entry k of each vector is the number of
+// cycles of length k, vectors have size n + 1.
+bool is_perfect_count_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+);
+bool is_perfect_count_holes(
+    const Packed_Bits_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+);
+bool is_perfect_count_holes(
+    const Byte_Matrix_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+);
+bool is_perfect_count_holes(
+    const Csr_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+);
@@ -0,0 +1,83 @@
+/* is_perfect_c.h
+ * C interface of the is_perfect library, for bindings from other languages.
+ * Graphs are read in place from the caller's memory, nothing is copied. */
+
+#ifndef IS_PERFECT_C_H
+#define IS_PERFECT_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Incremented when the layout of is_perfect_graph or a signature changes */
+#define IS_PERFECT_API_VERSION 2
+
+typedef enum is_perfect_status
+{
+    IS_PERFECT_OK = 0,
+    IS_PERFECT_INVALID_ARGUMENT = 1,
+    IS_PERFECT_OUT_OF_MEMORY = 2,
+    IS_PERFECT_INTERNAL_ERROR = 3
+} is_perfect_status;
+
+typedef enum is_perfect_graph_format
+{
+    /* data points to uint64_t words, bit j of row i is bit (j % 64) of word i * row_stride + j / 64 */
+    IS_PERFECT_PACKED_BITS = 0,
+    /* data points to uint8_t entries, entry (i, j) is byte i * row_stride + j, nonzero is an edge */
+    IS_PERFECT_BYTE_MATRIX = 1,
+    /* row_offsets has n + 1 entries, neighbors of v are column_indices[row_offsets[v] .. row_offsets[v + 1] - 1]
+     * in increasing order */
+    IS_PERFECT_CSR = 2
+} is_perfect_graph_format;
+
+/* Recognition engines, see Recognition_Engine in is_perfect_algo.h */
+typedef enum is_perfect_engine
+{
+    IS_PERFECT_ENGINE_AUTOMATIC = 0,
+    IS_PERFECT_ENGINE_PATH_DFS = 1,
+    IS_PERFECT_ENGINE_DECOMPOSITION = 2,
+    IS_PERFECT_ENGINE_RACE = 3
+} is_perfect_engine;
+
+/* Non-owning description of a simple undirected graph on vertices 0 .. n - 1 */
+typedef struct is_perfect_graph
+{
+    is_perfect_graph_format format;
+    int32_t n;
+
+    /* IS_PERFECT_PACKED_BITS and IS_PERFECT_BYTE_MATRIX */
+    const void *data;
+    size_t row_stride;
+
+    /* IS_PERFECT_CSR */
+    const int32_t *row_offsets;
+    const int32_t *column_indices;
+} is_perfect_graph;
+
+int is_perfect_api_version(void);
+
+/* Sets *result to 1 if the graph is perfect, 0 otherwise. Uses IS_PERFECT_ENGINE_AUTOMATIC. */
+is_perfect_status is_perfect_check(const is_perfect_graph *graph, int *result);
+
+/* Same as is_perfect_check, with the given recognition engine */
+is_perfect_status is_perfect_check_with_engine(
+    const is_perfect_graph *graph, is_perfect_engine engine, int *result
+);
+
+/* Counts odd holes and odd antiholes by length. Both arrays have n + 1 entries, entry k is the number
+ * of cycles of length k. Sets *result as is_perfect_check does. */
+is_perfect_status is_perfect_count_holes_by_length(
+    const is_perfect_graph *graph, uint64_t *odd_hole_counts, uint64_t *odd_antihole_counts, int *result
+);
+
+const char *is_perfect_status_string(is_perfect_status status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IS_PERFECT_C_H */
@@ -0,0 +1,190 @@
+// clique_cutset.cpp
+// Decomposition of a graph by clique minimal separators
+// Follows the algorithm of Berry, Pogorelcnik and Simonet, "An introduction to clique minimal separator
+// decomposition", Algorithms 3(2), 2010: a minimal triangulation is computed with MCS-M, and the
+// minimal separators it generates that are cliques of G cut the graph into atoms.
+
+#include "clique_cutset.h"
+
+#include <algorithm>
+
+namespace
+{
+
+struct Minimal_Triangulation
+{
+    // Vertices in elimination order, the first one is numbered 1 by MCS-M
+    std::vector<int> elimination_order;
+
+    // madj[v] holds the neighbors of v in the triangulation that are eliminated after v
+    std::vector<std::vector<int>> madj;
+
+    // v is a generator if madj[v] is a minimal separator of G
+    std::vector<bool> is_generator;
+};
+
+// MCS-M: vertices are numbered from n down to 1 by maximum weight. When v is numbered, every unnumbered
+// u reachable from v through unnumbered vertices of weight smaller than the weight of u gets an edge
+// to v in the triangulation, and its weight increases.
+Minimal_Triangulation get_minimal_triangulation(const std::vector<std::vector<int>> &graph_adj_list)
+{
+    int n = graph_adj_list.size();
+    Minimal_Triangulation triangulation;
+    triangulation.elimination_order.resize(n);
+    triangulation.madj.resize(n);
+    triangulation.is_generator.assign(n, false);
+
+    std::vector<int> weight(n, 0);
+    std::vector<bool> is_numbered(n, false), is_reached(n, false);
+    std::vector<std::vector<int>> reach(n);
+    std::vector<int> reached_list, updated_list;
+    int previous_weight = -1;
+
+    for (int number = n - 1; number >= 0; --number)
+    {
+        int v = -1;
+        for (int u = 0; u < n; ++u)
+        {
+            if (!is_numbered[u] && (v == -1 || weight[u] > weight[v]))
+                v = u;
+        }
+        is_numbered[v] = true;
+        triangulation.elimination_order[number] = v;
+        if (weight[v] <= previous_weight)
+            triangulation.is_generator[v] = true;
+        previous_weight = weight[v];
+
+        // Search by increasing weight, so that the largest interior weight on the path found first is
+        // as small as possible
+        reached_list.clear();
+        updated_list.clear();
+        for (auto u : graph_adj_list[v])
+        {
+            if (is_numbered[u])
+                continue;
+            is_reached[u] = true;
+            reached_list.push_back(u);
+            reach[weight[u]].push_back(u);
+            updated_list.push_back(u);
+        }
+        for (int level = 0; level < n; ++level)
+        {
+            while (!reach[level].empty())
+            {
+                int y = reach[level].back();
+                reach[level].pop_back();
+                for (auto z : graph_adj_list[y])
+                {
+                    if (is_numbered[z] || is_reached[z])
+                        continue;
+                    is_reached[z] = true;
+                    reached_list.push_back(z);
+                    if (weight[z] > level)
+                    {
+                        reach[weight[z]].push_back(z);
+                        updated_list.push_back(z);
+                    }
+                    else
+                    {
+                        reach[level].push_back(z);
+                    }
+                }
+            }
+        }
+
+        for (auto u : updated_list)
+        {
+            weight[u]++;
+            triangulation.madj[u].push_back(v);
+        }
+        for (auto u : reached_list)
+        {
+            is_reached[u] = false;
+        }
+    }
+    return triangulation;
+}
+
+} // namespace
+
+std::vector<std::vector<int>> get_clique_cutset_atoms(const std::vector<std::vector<int>> &graph_adj_list)
+{
+    int n = graph_adj_list.size();
+    auto triangulation = get_minimal_triangulation(graph_adj_list);
+
+    std::vector<std::vector<int>> atoms;
+    std::vector<bool> is_remaining(n, true), is_separator(n, false), is_visited(n, false);
+
+    for (auto x : triangulation.elimination_order)
+    {
+        if (!triangulation.is_generator[x] || !is_remaining[x])
+            continue;
+
+        // The separator is a clique if each of its vertices is adjacent to all the others
+        const auto &separator = triangulation.madj[x];
+        for (auto s : separator)
+            is_separator[s] = true;
+
+        bool is_clique = true;
+        for (auto s : separator)
+        {
+            int n_separator_neighbors = 0;
+            for (auto y : graph_adj_list[s])
+            {
+                if (is_separator[y])
+                    n_separator_neighbors++;
+            }
+            if (n_separator_neighbors != int(separator.size()) - 1)
+            {
+                is_clique = false;
+                break;
+            }
+        }
+        if (!is_clique)
+        {
+            for (auto s : separator)
+                is_separator[s] = false;
+            continue;
+        }
+
+        // The component of x in the remaining graph minus the separator is cut off with the separator
+
+        std::vector<int> component = {x};
+        is_visited[x] = true;
+        for (size_t head = 0; head < component.size(); ++head)
+        {
+            for (auto y : graph_adj_list[component[head]])
+            {
+                if (is_remaining[y] && !is_separator[y] && !is_visited[y])
+                {
+                    is_visited[y] = true;
+                    component.push_back(y);
+                }
+            }
+        }
+
+        std::vector<int> atom = component;
+        atom.insert(atom.end(), separator.begin(), separator.end());
+        std::sort(atom.begin(), atom.end());
+        atoms.push_back(std::move(atom));
+
+        for (auto v : component)
+        {
+            is_remaining[v] = false;
+            is_visited[v] = false;
+        }
+        for (auto s : separator)
+            is_separator[s] = false;
+    }
+
+    std::vector<int> last_atom;
+    for (int v = 0; v < n; ++v)
+    {
+        if (is_remaining[v])
+            last_atom.push_back(v);
+    }
+    if (!last_atom.empty())
+        atoms.push_back(std::move(last_atom));
+
+    return atoms;
+}
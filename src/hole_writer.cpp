@@ -0,0 +1,249 @@
+// hole_writer.cpp
+// Streaming output of odd holes and odd antiholes
+
+#include "hole_writer.h"
+
+#include <charconv>
+#include <cstring>
+
+// Binary format: file header is the magic "ISPH" followed by the version as uint32.
+// Graph record:       'G', uint32 path length, path bytes
+// Hole record:        'H' (hole) or 'A' (antihole), uint32 cycle length, uint32 vertices along the cycle
+// End of graph:       'E', uint8 is_perfect, uint64 number of odd holes, uint64 number of odd antiholes
+namespace
+{
+
+const char binary_magic[] = "ISPH";
+const uint32_t binary_version = 1;
+
+std::string escape_json_string(const std::string &str)
+{
+    std::string escaped;
+    for (const char &c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            const char hex_digits[] = "0123456789abcdef";
+            escaped += "\\u00";
+            escaped += hex_digits[(c >> 4) & 0xf];
+            escaped += hex_digits[c & 0xf];
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+} // namespace
+
+Hole_Writer::Hole_Writer(std::ostream &stream, Hole_Output_Format format, size_t buffer_size)
+    : stream(stream), format(format), buffer(buffer_size)
+{
+    if (format == Hole_Output_Format::binary)
+    {
+        reserve(8);
+        std::memcpy(buffer.data() + buffer_used, binary_magic, 4);
+        buffer_used += 4;
+        put_le(binary_version, 4);
+    }
+}
+
+Hole_Writer::~Hole_Writer()
+{
+    flush();
+}
+
+void Hole_Writer::flush()
+{
+    write_buffer();
+    if (!is_write_failed)
+    {
+        stream.flush();
+        if (stream.fail())
+            is_write_failed = true;
+    }
+    return;
+}
+
+bool Hole_Writer::has_failed() const
+{
+    return is_write_failed;
+}
+
+// Writes the buffered records to the stream and empties the buffer
+void Hole_Writer::write_buffer()
+{
+    if (buffer_used > 0 && !is_write_failed)
+    {
+        stream.write(buffer.data(), buffer_used);
+        if (stream.fail())
+            is_write_failed = true;
+    }
+    buffer_used = 0;
+    return;
+}
+
+// Makes room for n_bytes in the buffer. Records larger than the buffer grow it.
+void Hole_Writer::reserve(size_t n_bytes)
+{
+    if (buffer_used + n_bytes <= buffer.size())
+        return;
+
+    write_buffer();
+    if (n_bytes > buffer.size())
+        buffer.resize(n_bytes);
+    return;
+}
+
+void Hole_Writer::put(char c)
+{
+    reserve(1);
+    buffer[buffer_used++] = c;
+    return;
+}
+
+void Hole_Writer::put(const std::string &str)
+{
+    reserve(str.size());
+    std::memcpy(buffer.data() + buffer_used, str.data(), str.size());
+    buffer_used += str.size();
+    return;
+}
+
+void Hole_Writer::put_int(unsigned long long value)
+{
+    // 20 digits fit any 64 bit value
+    reserve(20);
+    auto result = std::to_chars(buffer.data() + buffer_used, buffer.data() + buffer.size(), value);
+    buffer_used = result.ptr - buffer.data();
+    return;
+}
+
+void Hole_Writer::put_le(uint64_t value, int n_bytes)
+{
+    reserve(n_bytes);
+    for (int i = 0; i < n_bytes; ++i)
+    {
+        buffer[buffer_used++] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    return;
+}
+
+void Hole_Writer::begin_graph(const std::string &graph_path)
+{
+    n_odd_holes = 0;
+    n_odd_antiholes = 0;
+
+    switch (format)
+    {
+    case Hole_Output_Format::text:
+        graph_name = graph_path;
+        break;
+    case Hole_Output_Format::json_lines:
+        graph_name = escape_json_string(graph_path);
+        break;
+    case Hole_Output_Format::binary:
+        graph_name = graph_path;
+        put('G');
+        put_le(graph_name.size(), 4);
+        put(graph_name);
+        break;
+    }
+    return;
+}
+
+void Hole_Writer::end_graph(bool is_perfect)
+{
+    switch (format)
+    {
+    case Hole_Output_Format::text:
+        put('\n');
+        break;
+    case Hole_Output_Format::json_lines:
+        put("{\"graph\":\"" + graph_name + "\",\"perfect\":" + (is_perfect ? "true" : "false") +
+            ",\"odd_holes\":");
+        put_int(n_odd_holes);
+        put(",\"odd_antiholes\":");
+        put_int(n_odd_antiholes);
+        put("}\n");
+        break;
+    case Hole_Output_Format::binary:
+        put('E');
+        put_le(is_perfect, 1);
+        put_le(n_odd_holes, 8);
+        put_le(n_odd_antiholes, 8);
+        break;
+    }
+    return;
+}
+
+void Hole_Writer::begin_holes(bool is_anti)
+{
+    is_anti_section = is_anti;
+    n_section_holes = 0;
+    return;
+}
+
+void Hole_Writer::write_hole(const std::vector<int> &cycle)
+{
+    switch (format)
+    {
+    case Hole_Output_Format::text:
+        // The number of cycles is not known in advance, so it is written after the listing
+        if (n_section_holes == 0)
+            put(is_anti_section ? "Printing odd antiholes:\n" : "Printing odd holes:\n");
+        for (const auto &v : cycle)
+        {
+            put_int(v);
+            put(", ");
+        }
+        put('\n');
+        break;
+    case Hole_Output_Format::json_lines:
+        put("{\"graph\":\"" + graph_name + "\",\"type\":\"" + (is_anti_section ? "antihole" : "hole") +
+            "\",\"length\":");
+        put_int(cycle.size());
+        put(",\"cycle\":[");
+        for (size_t i = 0; i < cycle.size(); ++i)
+        {
+            if (i > 0)
+                put(',');
+            put_int(cycle[i]);
+        }
+        put("]}\n");
+        break;
+    case Hole_Output_Format::binary:
+        put(is_anti_section ? 'A' : 'H');
+        put_le(cycle.size(), 4);
+        for (const auto &v : cycle)
+        {
+            put_le(v, 4);
+        }
+        break;
+    }
+    n_section_holes++;
+    return;
+}
+
+unsigned long long Hole_Writer::end_holes()
+{
+    if (is_anti_section)
+        n_odd_antiholes = n_section_holes;
+    else
+        n_odd_holes = n_section_holes;
+
+    if (format == Hole_Output_Format::text)
+    {
+        put(is_anti_section ? "Number of odd antiholes: " : "Number of odd holes: ");
+        put_int(n_section_holes);
+        put('\n');
+    }
+    return n_section_holes;
+}
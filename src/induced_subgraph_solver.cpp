@@ -0,0 +1,204 @@
+// induced_subgraph_solver.cpp
+// Perfection queries over many induced subgraphs of one host graph
+
+#include "induced_subgraph_solver.h"
+#include "is_perfect_algo.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+Induced_Subgraph_Solver::Induced_Subgraph_Solver(const std::vector<std::vector<bool>> &graph_adj_mat)
+{
+    int order = graph_adj_mat.size();
+    size_t stride = (order + 63) / 64;
+    std::vector<uint64_t> bits(order * stride, 0);
+    for (int i = 0; i < order; ++i)
+    {
+        for (int j = 0; j < order; ++j)
+        {
+            if (graph_adj_mat[i][j])
+                bits[i * stride + j / 64] |= uint64_t(1) << (j % 64);
+        }
+    }
+    init_rows(Packed_Bits_View{bits.data(), order, stride});
+}
+
+Induced_Subgraph_Solver::Induced_Subgraph_Solver(const Packed_Bits_View &graph)
+{
+    init_rows(graph);
+}
+
+void Induced_Subgraph_Solver::init_rows(const Packed_Bits_View &graph)
+{
+    n = graph.size();
+    row_stride = (n + 63) / 64;
+    graph_rows.assign(n * row_stride, 0);
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (size_t word_id = 0; word_id < row_stride; ++word_id)
+        {
+            // Bits past n in the last word and the diagonal are cleared
+            uint64_t valid_bits = ~uint64_t(0);
+            if ((word_id + 1) * 64 > size_t(n))
+                valid_bits = (uint64_t(1) << (n - word_id * 64)) - 1;
+            if (size_t(i / 64) == word_id)
+                valid_bits &= ~(uint64_t(1) << (i % 64));
+
+            graph_rows[i * row_stride + word_id] = graph.bits[i * graph.row_stride + word_id] & valid_bits;
+        }
+    }
+    return;
+}
+
+// Copies G[S] into bit rows of |S| vertices, subset_vertices[a] becoming vertex a, and decides it with the
+// automatic engine. The witness found by the engine is mapped back to host vertices.
+bool Induced_Subgraph_Solver::is_perfect_subgraph(
+    const std::vector<int> &subset_vertices, std::vector<int> &witness, bool &is_antihole
+) const
+{
+    int k = subset_vertices.size();
+    size_t local_stride = (k + 63) / 64;
+    std::vector<uint64_t> local_rows(k * local_stride, 0);
+    for (int a = 0; a < k; ++a)
+    {
+        for (int b = a + 1; b < k; ++b)
+        {
+            if (is_adjacent(subset_vertices[a], subset_vertices[b]))
+            {
+                local_rows[a * local_stride + b / 64] |= uint64_t(1) << (b % 64);
+                local_rows[b * local_stride + a / 64] |= uint64_t(1) << (a % 64);
+            }
+        }
+    }
+
+    if (::is_perfect(Packed_Bits_View{local_rows.data(), k, local_stride}, witness, is_antihole))
+        return true;
+
+    for (auto &v : witness)
+        v = subset_vertices[v];
+    return false;
+}
+
+bool Induced_Subgraph_Solver::find_cached_witness(
+    const std::vector<bool> &subset, std::vector<int> &witness, bool &is_antihole
+) const
+{
+    std::shared_lock lock(witness_mutex);
+    for (const auto &cached : witnesses)
+    {
+        bool is_contained = true;
+        for (auto v : cached.sorted_vertices)
+        {
+            if (size_t(v) >= subset.size() || !subset[v])
+            {
+                is_contained = false;
+                break;
+            }
+        }
+        if (is_contained)
+        {
+            witness = cached.cycle;
+            is_antihole = cached.is_antihole;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Induced_Subgraph_Solver::cache_witness(const std::vector<int> &cycle, bool is_antihole)
+{
+    Witness new_witness;
+    new_witness.cycle = cycle;
+    new_witness.sorted_vertices = cycle;
+    std::sort(new_witness.sorted_vertices.begin(), new_witness.sorted_vertices.end());
+    new_witness.is_antihole = is_antihole;
+
+    std::unique_lock lock(witness_mutex);
+    // Threads may find the same cycle at the same time
+    for (const auto &cached : witnesses)
+    {
+        if (cached.sorted_vertices == new_witness.sorted_vertices)
+            return;
+    }
+    if (witnesses.size() < max_cached_witnesses)
+    {
+        witnesses.push_back(std::move(new_witness));
+    }
+    else
+    {
+        witnesses[next_replaced_witness] = std::move(new_witness);
+        next_replaced_witness = (next_replaced_witness + 1) % max_cached_witnesses;
+    }
+    return;
+}
+
+size_t Induced_Subgraph_Solver::n_cached_witnesses() const
+{
+    std::shared_lock lock(witness_mutex);
+    return witnesses.size();
+}
+
+bool Induced_Subgraph_Solver::is_perfect(const std::vector<bool> &subset)
+{
+    std::vector<int> witness;
+    bool is_antihole;
+    return is_perfect(subset, witness, is_antihole);
+}
+
+bool Induced_Subgraph_Solver::is_perfect(
+    const std::vector<bool> &subset, std::vector<int> &witness, bool &is_antihole
+)
+{
+    std::vector<int> subset_vertices;
+    for (int v = 0; v < n && size_t(v) < subset.size(); ++v)
+    {
+        if (subset[v])
+            subset_vertices.push_back(v);
+    }
+
+    // Odd holes have at least 5 vertices
+    if (subset_vertices.size() < 5)
+        return true;
+
+    if (find_cached_witness(subset, witness, is_antihole))
+        return false;
+
+    if (is_perfect_subgraph(subset_vertices, witness, is_antihole))
+        return true;
+
+    cache_witness(witness, is_antihole);
+    return false;
+}
+
+std::vector<bool> Induced_Subgraph_Solver::is_perfect_batch(
+    const std::vector<std::vector<bool>> &subsets, int n_threads
+)
+{
+    if (n_threads <= 0)
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    n_threads = std::max(1, std::min<int>(n_threads, subsets.size()));
+
+    // One byte per result, so that threads do not share the words of a vector<bool>
+    std::vector<char> results(subsets.size());
+    std::atomic<size_t> next_query = 0;
+
+    auto query_worker = [&]()
+    {
+        for (size_t query = next_query++; query < subsets.size(); query = next_query++)
+        {
+            results[query] = is_perfect(subsets[query]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < n_threads; ++t)
+        threads.emplace_back(query_worker);
+    query_worker();
+    for (auto &thread : threads)
+        thread.join();
+
+    return std::vector<bool>(results.begin(), results.end());
+}
@@ -8,6 +8,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <getopt.h>
 #include <iomanip>
 #include <iostream>
@@ -18,13 +19,32 @@ struct Program_Options
     std::string graph_file_path;
     std::string graph_folder_path;
     std::string experiment_csv_path;
+    std::string hole_output_path;
 
     bool verbose_perfect = false;
     bool verbose_nonperfect = false;
     bool verbose_holes = false;
+    bool count_holes = false;
 
     bool is_run_for_folder = false;
     bool is_run_for_file = false;
+
+    Hole_Enumeration_Engine hole_engine = Hole_Enumeration_Engine::path_dfs;
+    Hole_Output_Format hole_output_format = Hole_Output_Format::text;
+    Recognition_Engine recognition_engine = Recognition_Engine::automatic;
+
+    // Options that only apply to some modes, to reject the others
+    bool is_hole_engine_given = false;
+    bool is_hole_format_given = false;
+    bool is_recognition_engine_given = false;
+};
+
+// Long options without a short form
+enum Long_Only_Option
+{
+    option_format = 256,
+    option_output,
+    option_solver
 };
 
 struct Program_Log
@@ -55,11 +75,23 @@ void print_usage()
               << "Log non-perfect graphs\n"
               << std::setw(col_width) << "  -o, --holes"
               << "Log odd holes and odd antiholes\n"
+              << std::setw(col_width) << "  -c, --count"
+              << "Count odd holes and odd antiholes by length, without listing them\n"
+              << std::setw(col_width) << "  -e, --engine ENGINE"
+              << "Enumeration engine for --holes: \"dfs\" (default) or \"chordless\"\n"
+              << std::setw(col_width) << "      --format FORMAT"
+              << "Format of --holes listing: \"text\" (default), \"jsonl\" or \"binary\"\n"
+              << std::setw(col_width) << "      --output FILE"
+              << "Write --holes listing to FILE instead of the console\n"
+              << std::setw(col_width) << "      --solver SOLVER"
+              << "Recognition engine: \"auto\" (default), \"dfs\", \"decomposition\" or \"race\"\n"
               << std::setw(col_width) << "  -h, --help"
               << "Show this help message\n";
 }
 
-void run_for_graph_file(std::string &path, Program_Options &options, Program_Log &program_log)
+void run_for_graph_file(
+    std::string &path, Program_Options &options, Program_Log &program_log, Hole_Writer &hole_writer
+)
 {
     // File Checks
     if (!std::filesystem::is_regular_file(path))
@@ -83,27 +115,40 @@ void run_for_graph_file(std::string &path, Program_Options &options, Program_Log
     Graph_File_Info graph_file_info_obj;
     parse_graph_detail(path, graph_file_info_obj);
 
-    // Solve
+    // Solve. Holes are streamed to hole_writer during the search.
     std::string log_hole_str = "";
     bool result;
     auto time_start = std::chrono::high_resolution_clock::now();
-    if (options.verbose_holes)
+    if (options.count_holes)
+    {
+        std::vector<unsigned long long> odd_hole_counts, odd_antihole_counts;
+        result = is_perfect_count_holes(graph, odd_hole_counts, odd_antihole_counts);
+        log_odd_hole_counts(odd_hole_counts, log_hole_str, false);
+        log_odd_hole_counts(odd_antihole_counts, log_hole_str, true);
+    }
+    else if (options.verbose_holes)
     {
-        result = is_perfect_log_holes(graph, log_hole_str);
+        hole_writer.begin_graph(path);
+        result = is_perfect_write_holes(graph, hole_writer, options.hole_engine);
+        hole_writer.end_graph(result);
+
+        // Keep the console output in order
+        if (options.hole_output_path.empty())
+            hole_writer.flush();
     }
     else
     {
-        result = is_perfect(graph);
+        result = is_perfect(graph, options.recognition_engine);
     }
     auto time_end = std::chrono::high_resolution_clock::now();
 
     // Prints
     if (options.verbose_perfect && result)
-        std::cout << "Perfect: " << path << std::endl;
+        std::cout << "Perfect: " << path << '\n';
     if (options.verbose_nonperfect && !result)
-        std::cout << "Non-perfect: " << path << std::endl;
-    if (options.verbose_holes)
-        std::cout << log_hole_str << std::endl;
+        std::cout << "Non-perfect: " << path << '\n';
+    if (options.count_holes)
+        std::cout << log_hole_str << '\n';
 
     result ? program_log.n_perfect++ : program_log.n_nonperfect++;
 
@@ -133,11 +178,16 @@ int main(int argc, char *argv[])
         {"perfect", no_argument, nullptr, 'p'},
         {"nonperfect", no_argument, nullptr, 'n'},
         {"holes", no_argument, nullptr, 'o'},
+        {"count", no_argument, nullptr, 'c'},
+        {"engine", required_argument, nullptr, 'e'},
+        {"format", required_argument, nullptr, option_format},
+        {"output", required_argument, nullptr, option_output},
+        {"solver", required_argument, nullptr, option_solver},
         {nullptr, 0, nullptr, 0}
     };
 
     int opt;
-    while ((opt = getopt_long(argc, argv, "hi:f:pno", long_opts, nullptr)) != -1)
+    while ((opt = getopt_long(argc, argv, "hi:f:pnoce:", long_opts, nullptr)) != -1)
     {
         switch (opt)
         {
@@ -163,6 +213,55 @@ int main(int argc, char *argv[])
         case 'o':
             program_options.verbose_holes = true;
             break;
+        case 'c':
+            program_options.count_holes = true;
+            break;
+        case 'e':
+            program_options.is_hole_engine_given = true;
+            if (std::string(optarg) == "dfs")
+                program_options.hole_engine = Hole_Enumeration_Engine::path_dfs;
+            else if (std::string(optarg) == "chordless")
+                program_options.hole_engine = Hole_Enumeration_Engine::chordless_cycles;
+            else
+            {
+                std::cerr << "Error: Unknown engine \"" << optarg << "\". Use \"dfs\" or \"chordless\".\n";
+                return 1;
+            }
+            break;
+        case option_format:
+            program_options.is_hole_format_given = true;
+            if (std::string(optarg) == "text")
+                program_options.hole_output_format = Hole_Output_Format::text;
+            else if (std::string(optarg) == "jsonl")
+                program_options.hole_output_format = Hole_Output_Format::json_lines;
+            else if (std::string(optarg) == "binary")
+                program_options.hole_output_format = Hole_Output_Format::binary;
+            else
+            {
+                std::cerr << "Error: Unknown format \"" << optarg << "\". Use \"text\", \"jsonl\" or \"binary\".\n";
+                return 1;
+            }
+            break;
+        case option_output:
+            program_options.hole_output_path = optarg;
+            break;
+        case option_solver:
+            program_options.is_recognition_engine_given = true;
+            if (std::string(optarg) == "auto")
+                program_options.recognition_engine = Recognition_Engine::automatic;
+            else if (std::string(optarg) == "dfs")
+                program_options.recognition_engine = Recognition_Engine::path_dfs;
+            else if (std::string(optarg) == "decomposition")
+                program_options.recognition_engine = Recognition_Engine::decomposition;
+            else if (std::string(optarg) == "race")
+                program_options.recognition_engine = Recognition_Engine::race;
+            else
+            {
+                std::cerr << "Error: Unknown solver \"" << optarg
+                          << "\". Use \"auto\", \"dfs\", \"decomposition\" or \"race\".\n";
+                return 1;
+            }
+            break;
         default:
             print_usage();
             return 1;
@@ -183,6 +282,67 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (program_options.count_holes)
+    {
+        if (program_options.verbose_holes)
+        {
+            std::cerr << "Error: Either count or list the holes.\n"
+                      << "       --count (-c) and --holes (-o) cannot be given simultaneously.\n";
+            return 1;
+        }
+        if (program_options.is_hole_engine_given || program_options.is_hole_format_given ||
+            !program_options.hole_output_path.empty() || program_options.is_recognition_engine_given)
+        {
+            std::cerr << "Error: --count (-c) always uses the chordless engine and prints to the console.\n"
+                      << "       --engine (-e), --format, --output and --solver cannot be given with it.\n";
+            return 1;
+        }
+    }
+
+    if (program_options.verbose_holes && program_options.is_recognition_engine_given)
+    {
+        std::cerr << "Error: --holes (-o) lists every hole, so it does not use --solver.\n"
+                  << "       Use --engine (-e) to choose how holes are listed.\n";
+        return 1;
+    }
+
+    if (!program_options.verbose_holes && program_options.is_hole_engine_given)
+    {
+        std::cerr << "Error: --engine (-e) selects how holes are listed.\n"
+                  << "       It requires --holes (-o).\n";
+        return 1;
+    }
+
+    if (!program_options.verbose_holes &&
+        (program_options.is_hole_format_given || !program_options.hole_output_path.empty()))
+    {
+        std::cerr << "Error: --format and --output only apply to the listing of holes.\n"
+                  << "       They require --holes (-o).\n";
+        return 1;
+    }
+
+    // Status lines go to the console, so only the text listing can share it
+    if (program_options.hole_output_format != Hole_Output_Format::text && program_options.hole_output_path.empty())
+    {
+        std::cerr << "Error: JSON Lines and binary formats require an output file, given with --output.\n";
+        return 1;
+    }
+
+    // Holes go to the console unless an output file is given
+    std::ofstream hole_output_file;
+    if (!program_options.hole_output_path.empty())
+    {
+        hole_output_file.open(program_options.hole_output_path, std::ios::binary);
+        if (!hole_output_file)
+        {
+            std::cerr << "Unable to open output file: " << program_options.hole_output_path << "\n";
+            return 1;
+        }
+    }
+    Hole_Writer hole_writer(
+        program_options.hole_output_path.empty() ? std::cout : hole_output_file, program_options.hole_output_format
+    );
+
     // Main process, for a folder
     if (program_options.is_run_for_folder)
     {
@@ -227,7 +387,7 @@ int main(int argc, char *argv[])
 
             // Progress bar output. Displayed when there is no console output of the runs
             if (!program_options.verbose_perfect && !program_options.verbose_nonperfect &&
-                !program_options.verbose_holes)
+                !program_options.verbose_holes && !program_options.count_holes)
             {
 
                 double progress_width = static_cast<double>(i) / n_graphs * bar_width;
@@ -243,11 +403,15 @@ int main(int argc, char *argv[])
                 i++;
             }
 
-            run_for_graph_file(file_path_str, program_options, program_log);
+            run_for_graph_file(file_path_str, program_options, program_log, hole_writer);
+
+            // Listings of later graphs would be lost as well
+            if (hole_writer.has_failed())
+                break;
         }
         // Progress Bar finished
         if (!program_options.verbose_perfect && !program_options.verbose_nonperfect &&
-            !program_options.verbose_holes)
+            !program_options.verbose_holes && !program_options.count_holes)
         {
             std::cout << "\rProgress: [";
             for (int j = 0; j < bar_width; j++)
@@ -274,7 +438,16 @@ int main(int argc, char *argv[])
 
         std::cout << "Running is_perfect for file: " << program_options.graph_file_path << "\n\n";
 
-        run_for_graph_file(program_options.graph_file_path, program_options, program_log);
+        run_for_graph_file(program_options.graph_file_path, program_options, program_log, hole_writer);
+    }
+
+    hole_writer.flush();
+    if (hole_writer.has_failed())
+    {
+        std::cerr << "Unable to write output file: "
+                  << (program_options.hole_output_path.empty() ? "standard output" : program_options.hole_output_path)
+                  << "\n";
+        return 1;
     }
 
     program_log.time_end = std::chrono::high_resolution_clock::now();
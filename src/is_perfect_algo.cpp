@@ -2,24 +2,419 @@
 // Author: Burak Nur Erdem
 
 #include "is_perfect_algo.h"
-#include "utils.h"
+#include "clique_cutset.h"
+#include "graph_view.h"
 
-void odd_hole_recursive(
-    const std::vector<std::vector<bool>> &graph_adj_mat,
-    const std::vector<std::vector<int>> &graph_adj_list,
-    std::vector<int> &path_vector,
-    std::unordered_map<std::vector<bool>, std::vector<int>> &odd_holes,
-    bool is_anti_hole_search,
-    int termination_batch_size
-)
+#include <algorithm>
+#include <atomic>
+#include <span>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+
+// The searches walk the neighbors of a vertex through one of the adjacency types below. Both provide
+// size(), degree(v), neighbors(v) and neighbors_after(v, first), the neighbors of v greater than first,
+// as ranges in increasing order.
+
+// Adjacency lists, O(n + m) ints. Used for the graph itself.
+struct Adjacency_Lists
+{
+    std::vector<std::vector<int>> lists;
+
+    int size() const
+    {
+        return lists.size();
+    }
+    int degree(int v) const
+    {
+        return lists[v].size();
+    }
+    const std::vector<int> &neighbors(int v) const
+    {
+        return lists[v];
+    }
+    std::span<const int> neighbors_after(int v, int first) const
+    {
+        return {std::upper_bound(lists[v].begin(), lists[v].end(), first), lists[v].end()};
+    }
+};
+
+// End of a row, reached once every word is consumed
+struct Bit_Row_End
+{
+};
+
+// Walks the set bits of a row, or its clear bits for a complement. The diagonal and the bits past n are
+// skipped.
+struct Bit_Row_Iterator
+{
+    const uint64_t *row;
+    int n;
+    int n_words;
+    int v;
+    bool is_complement;
+    int word_id;
+    uint64_t word;
+
+    uint64_t load_word(int id) const
+    {
+        uint64_t loaded = is_complement ? ~row[id] : row[id];
+        if ((id + 1) * 64 > n)
+            loaded &= (uint64_t(1) << (n - id * 64)) - 1;
+        if (id == v / 64)
+            loaded &= ~(uint64_t(1) << (v % 64));
+        return loaded;
+    }
+    void skip_empty_words()
+    {
+        while (word == 0 && ++word_id < n_words)
+            word = load_word(word_id);
+    }
+
+    int operator*() const
+    {
+        return word_id * 64 + std::countr_zero(word);
+    }
+    Bit_Row_Iterator &operator++()
+    {
+        word &= word - 1;
+        skip_empty_words();
+        return *this;
+    }
+    bool operator==(Bit_Row_End) const
+    {
+        return word_id == n_words;
+    }
+};
+
+struct Bit_Row_Range
+{
+    Bit_Row_Iterator first;
+
+    Bit_Row_Iterator begin() const
+    {
+        return first;
+    }
+    Bit_Row_End end() const
+    {
+        return {};
+    }
+};
+
+// Adjacency read from the rows of a Packed_Bits_View, or of its complement, in place. Used for the
+// complement, whose adjacency lists would take O(n^2) ints.
+struct Bit_Rows_Adjacency
 {
+    Packed_Bits_View graph;
+    bool is_complement;
 
-    if (termination_batch_size != 0 && (odd_holes.size() >= termination_batch_size))
+    int size() const
+    {
+        return graph.n;
+    }
+    int degree(int v) const
+    {
+        int n_words = (graph.n + 63) / 64;
+        Bit_Row_Iterator row{graph.bits + v * graph.row_stride, graph.n, n_words, v, is_complement, 0, 0};
+        int n_neighbors = 0;
+        for (int word_id = 0; word_id < n_words; ++word_id)
+            n_neighbors += std::popcount(row.load_word(word_id));
+        return n_neighbors;
+    }
+    Bit_Row_Range neighbors(int v) const
     {
+        return neighbors_after(v, -1);
+    }
+    Bit_Row_Range neighbors_after(int v, int first) const
+    {
+        int n_words = (graph.n + 63) / 64;
+        const uint64_t *row = graph.bits + v * graph.row_stride;
+        Bit_Row_Iterator it{row, graph.n, n_words, v, is_complement, n_words, 0};
+        int start = first + 1;
+        if (start >= graph.n)
+            return {it};
+
+        it.word_id = start / 64;
+        it.word = it.load_word(it.word_id) & (~uint64_t(0) << (start % 64));
+        it.skip_empty_words();
+        return {it};
+    }
+};
+
+// Calls search(search_graph, adjacency) for the graph. The complement of a Packed_Bits_View is searched on
+// its rows in place, and the complement of another view is packed once, in n^2 / 8 bytes.
+template <typename Graph_View, typename Search>
+void run_search_on_adjacency(const Graph_View &graph, Search &&search)
+{
+    const Adjacency_Lists adjacency{get_adj_list_from_view(graph)};
+    search(graph, adjacency);
+    return;
+}
+
+template <typename Search>
+void run_search_on_adjacency(const Complement_View<Packed_Bits_View> &graph, Search &&search)
+{
+    search(graph, Bit_Rows_Adjacency{graph.graph, true});
+    return;
+}
+
+template <typename Graph_View, typename Search>
+void run_search_on_adjacency(const Complement_View<Graph_View> &graph, Search &&search)
+{
+    int n = graph.size();
+    size_t row_stride = (n + 63) / 64;
+    std::vector<uint64_t> rows(n * row_stride, 0);
+    std::vector<int> neighbors;
+    for (int v = 0; v < n; ++v)
+    {
+        neighbors.clear();
+        graph.graph.append_neighbors(v, neighbors);
+        for (auto u : neighbors)
+            rows[v * row_stride + u / 64] |= uint64_t(1) << (u % 64);
+    }
+    Packed_Bits_View packed_graph{rows.data(), n, row_stride};
+    search(Complement_View<Packed_Bits_View>{packed_graph}, Bit_Rows_Adjacency{packed_graph, true});
+    return;
+}
+
+// Induced subgraph G[{r..n-1}] of the current root r, reduced to its 2-core. Vertices are deleted as
+// the root advances, and degrees are kept up to date so that peeling is incremental over all roots.
+struct Suffix_Subgraph
+{
+    std::vector<bool> is_alive;
+    std::vector<int> degree;
+
+    // Id of the biconnected block of the root that contains the vertex, -1 if the vertex is in no
+    // such block. Recomputed for every root.
+    std::vector<int> root_block;
+
+    // Scratch space of the block labelling, kept over roots. Only the vertices in labelled_vertices
+    // were touched by the last labelling, and only they are reset by the next one.
+    std::vector<int> discovery;
+    std::vector<int> low;
+    std::vector<int> vertex_stack;
+    std::vector<int> labelled_vertices;
+};
+
+// Removes v from the suffix subgraph and peels the vertices whose degree drops below 2, since a
+// vertex of degree 0 or 1 cannot lie on a cycle.
+template <typename Adjacency>
+void delete_vertex_and_peel(const Adjacency &adjacency, Suffix_Subgraph &suffix, int v)
+{
+    if (!suffix.is_alive[v])
         return;
+
+    std::vector<int> peel_stack = {v};
+    suffix.is_alive[v] = false;
+    while (!peel_stack.empty())
+    {
+        int u = peel_stack.back();
+        peel_stack.pop_back();
+        for (auto w : adjacency.neighbors(u))
+        {
+            if (!suffix.is_alive[w])
+                continue;
+            suffix.degree[w]--;
+            if (suffix.degree[w] < 2)
+            {
+                suffix.is_alive[w] = false;
+                peel_stack.push_back(w);
+            }
+        }
     }
+    return;
+}
 
+template <typename Adjacency>
+Suffix_Subgraph init_suffix_subgraph(const Adjacency &adjacency)
+{
+    int n = adjacency.size();
+    Suffix_Subgraph suffix;
+    suffix.is_alive.assign(n, true);
+    suffix.degree.resize(n);
+    suffix.root_block.assign(n, -1);
+    suffix.discovery.assign(n, -1);
+    suffix.low.assign(n, -1);
+
+    for (int v = 0; v < n; ++v)
+    {
+        suffix.degree[v] = adjacency.degree(v);
+    }
+    for (int v = 0; v < n; ++v)
+    {
+        if (suffix.is_alive[v] && suffix.degree[v] < 2)
+        {
+            delete_vertex_and_peel(adjacency, suffix, v);
+        }
+    }
+    return suffix;
+}
+
+// Tarjan's biconnected components restricted to the alive vertices. Only the blocks that contain the
+// root are labelled, since any hole through the root lies entirely in one of them.
+template <typename Adjacency>
+void label_root_blocks_recursive(
+    const Adjacency &adjacency,
+    Suffix_Subgraph &suffix,
+    int root,
+    int v,
+    int &timer,
+    int &n_blocks
+)
+{
+    auto &discovery = suffix.discovery;
+    auto &low = suffix.low;
+    auto &vertex_stack = suffix.vertex_stack;
+
+    discovery[v] = low[v] = timer++;
+    vertex_stack.push_back(v);
+    suffix.labelled_vertices.push_back(v);
+
+    for (auto w : adjacency.neighbors(v))
+    {
+        if (!suffix.is_alive[w])
+            continue;
+
+        if (discovery[w] == -1)
+        {
+            label_root_blocks_recursive(adjacency, suffix, root, w, timer, n_blocks);
+            low[v] = std::min(low[v], low[w]);
+
+            // v separates the subtree of w, so the vertices above w on the stack close a block with v
+            if (low[w] >= discovery[v])
+            {
+                int block_id = (v == root) ? n_blocks++ : -1;
+                int popped;
+                do
+                {
+                    popped = vertex_stack.back();
+                    vertex_stack.pop_back();
+                    suffix.root_block[popped] = block_id;
+                } while (popped != w);
+            }
+        }
+        else
+        {
+            low[v] = std::min(low[v], discovery[w]);
+        }
+    }
+    return;
+}
+
+// Labels the blocks of the root and drops those with less than min_block_size vertices (root
+// included), as they cannot contain a wanted cycle. Returns the number of labelled vertices.
+template <typename Adjacency>
+int label_root_blocks(const Adjacency &adjacency, Suffix_Subgraph &suffix, int root, int min_block_size)
+{
+    int n = adjacency.size();
+    for (auto v : suffix.labelled_vertices)
+    {
+        suffix.root_block[v] = -1;
+        suffix.discovery[v] = -1;
+        suffix.low[v] = -1;
+    }
+    suffix.labelled_vertices.clear();
+
+    // A graph of minimum degree at least half its order is biconnected, so the alive suffix is a single
+    // block of the root and the pass over its edges is skipped. This is the common case on the dense
+    // side of the search.
+    int n_alive = 0, min_degree = n;
+    for (int v = root; v < n; ++v)
+    {
+        if (suffix.is_alive[v])
+        {
+            n_alive++;
+            min_degree = std::min(min_degree, suffix.degree[v]);
+        }
+    }
+    if (2 * min_degree >= n_alive)
+    {
+        if (n_alive < min_block_size)
+            return 0;
+        for (int v = root + 1; v < n; ++v)
+        {
+            if (suffix.is_alive[v])
+            {
+                suffix.root_block[v] = 0;
+                suffix.labelled_vertices.push_back(v);
+            }
+        }
+        return n_alive - 1;
+    }
+
+    int timer = 0, n_blocks = 0;
+    label_root_blocks_recursive(adjacency, suffix, root, root, timer, n_blocks);
+    suffix.root_block[root] = -1;
+
+    std::vector<int> block_sizes(n_blocks, 0);
+    for (auto v : suffix.labelled_vertices)
+    {
+        if (suffix.root_block[v] != -1)
+            block_sizes[suffix.root_block[v]]++;
+    }
+
+    int n_labelled = 0;
+    for (auto v : suffix.labelled_vertices)
+    {
+        if (suffix.root_block[v] == -1)
+            continue;
+        if (block_sizes[suffix.root_block[v]] + 1 < min_block_size)
+            suffix.root_block[v] = -1;
+        else
+            n_labelled++;
+    }
+    return n_labelled;
+}
+
+// Limits of a DFS run, used to probe the search and to cancel it from another thread
+struct Search_Limits
+{
+    // Work after which the search is aborted, 0 is unlimited. A recursive call costs one plus the number
+    // of neighbors it scans, so that the budget tracks the running time on dense graphs as well.
+    unsigned long long work_budget = 0;
+    // Raised by another thread to abort the search
+    const std::atomic<bool> *stop_flag = nullptr;
+
+    unsigned long long n_nodes = 0;
+    unsigned long long work = 0;
+    bool is_aborted = false;
+};
+
+bool is_search_aborted(Search_Limits &limits, int n_scanned_neighbors)
+{
+    limits.n_nodes++;
+    limits.work += 1 + n_scanned_neighbors;
+    if ((limits.work_budget != 0 && limits.work > limits.work_budget) ||
+        (limits.stop_flag != nullptr && (limits.n_nodes & 1023) == 0 &&
+         limits.stop_flag->load(std::memory_order_relaxed)))
+    {
+        limits.is_aborted = true;
+    }
+    return limits.is_aborted;
+}
+
+// report_hole is called with each odd hole found, once for each direction of the cycle. It returns true
+// when the search should stop, in which case true is returned up the recursion. Aborting the search on
+// its limits stops it the same way.
+template <typename Graph_View, typename Adjacency, typename Report_Hole>
+bool odd_hole_recursive(
+    const Graph_View &graph,
+    const Adjacency &adjacency,
+    const Suffix_Subgraph &suffix,
+    std::vector<int> &path_vector,
+    bool is_anti_hole_search,
+    Report_Hole &report_hole,
+    Search_Limits &limits
+)
+{
     int last_added_v = path_vector.back();
+
+    // The loop below scans about the alive neighbors of the last vertex
+    if (is_search_aborted(limits, suffix.degree[last_added_v]))
+        return true;
+
     int path_length = path_vector.size();
 
     int wanted_min_cycle_length;
@@ -35,13 +430,16 @@ void odd_hole_recursive(
         wanted_min_cycle_length = 5;
     }
 
-    // for neighbors of last vertex
-    for (auto i : graph_adj_list[last_added_v])
-    {
+    // Every vertex of the path after the root lies in the same block of the root
+    int path_block = (path_length > 1) ? suffix.root_block[path_vector[1]] : -1;
 
-        // Smaller indices of the start vertex is not considered. So an odd-hole is only identified
-        // when path start with its smallest indexed vertex smallest index vertex
-        if (i < path_vector[0])
+    // for neighbors of last vertex. Smaller indices of the start vertex is not considered. So an
+    // odd-hole is only identified when path start with its smallest indexed vertex. Neighbors are
+    // listed in increasing order, so those are skipped at once.
+    for (auto i : adjacency.neighbors_after(last_added_v, path_vector[0]))
+    {
+        // Vertices that were peeled or that are out of the block of the path cannot close a hole.
+        if (suffix.root_block[i] == -1 || (path_length > 1 && suffix.root_block[i] != path_block))
             continue;
 
         // It skips the vertex if it the one added before last_added_v.
@@ -56,7 +454,7 @@ void odd_hole_recursive(
         for (int j = 1; (path_length > 2) && (j < (path_length - 1)); ++j)
         {
             // if chord exist, no odd hole, no need to continue the path with this vertex.
-            if (graph_adj_mat[i][path_vector[j]])
+            if (graph.is_adjacent(i, path_vector[j]))
             {
                 chord_exist = true;
                 break;
@@ -65,7 +463,7 @@ void odd_hole_recursive(
 
         // if there is no chord, then check for cycle (hole), and if cycle exists, check if it is
         // an oddhole. If it is an even-hole, pass vertex i.
-        if ((!chord_exist) && (path_length > 1) && (graph_adj_mat[path_vector[0]][i]))
+        if ((!chord_exist) && (path_length > 1) && (graph.is_adjacent(path_vector[0], i)))
         {
 
             int cycle_length = path_length + 1;
@@ -73,12 +471,11 @@ void odd_hole_recursive(
             if (cycle_length % 2 == 1 && cycle_length >= wanted_min_cycle_length)
             { // if true, then odd hole is found
 
-                // add found odd hole to the data structure.
-                auto odd_hole = path_vector;
-                odd_hole.push_back(i);
-
-                auto cycle_vert_subset = cycle_vector_to_bool_vec(odd_hole, graph_adj_mat.size());
-                odd_holes.try_emplace(cycle_vert_subset, std::move(odd_hole));
+                path_vector.push_back(i);
+                bool is_search_stopped = report_hole(path_vector);
+                path_vector.pop_back();
+                if (is_search_stopped)
+                    return true;
             }
         }
 
@@ -86,67 +483,954 @@ void odd_hole_recursive(
         else if (!chord_exist)
         {
             path_vector.push_back(i);
-            odd_hole_recursive(
-                graph_adj_mat, graph_adj_list, path_vector, odd_holes, is_anti_hole_search,
-                termination_batch_size
-            );
+            if (odd_hole_recursive(
+                    graph, adjacency, suffix, path_vector, is_anti_hole_search, report_hole, limits
+                ))
+                return true;
         }
     }
 
     path_vector.pop_back();
+    return false;
+}
+
+template <typename Graph_View, typename Adjacency, typename Report_Hole>
+void enumerate_odd_holes_dfs(
+    const Graph_View &graph,
+    const Adjacency &adjacency,
+    bool is_anti_hole_search,
+    Report_Hole &report_hole,
+    Search_Limits &limits
+)
+{
+    int wanted_min_cycle_length = is_anti_hole_search ? 7 : 5;
+    auto suffix = init_suffix_subgraph(adjacency);
+
+    for (int i = 0; i < graph.size(); ++i)
+    {
+        // Root i is searched on the 2-core of G[{i..n-1}], restricted to the blocks containing i
+        if (suffix.is_alive[i] &&
+            label_root_blocks(adjacency, suffix, i, wanted_min_cycle_length) >= wanted_min_cycle_length - 1)
+        {
+            std::vector<int> path_vector = {i};
+            path_vector.reserve(graph.size());
+            if (odd_hole_recursive(
+                    graph, adjacency, suffix, path_vector, is_anti_hole_search, report_hole, limits
+                ))
+                return;
+        }
+
+        // Next roots never use i
+        delete_vertex_and_peel(adjacency, suffix, i);
+    }
     return;
 }
 
+template <typename Graph_View, typename Report_Hole>
+void enumerate_odd_holes_dfs(
+    const Graph_View &graph, bool is_anti_hole_search, Report_Hole &report_hole, Search_Limits &limits
+)
+{
+    run_search_on_adjacency(
+        graph,
+        [&](const auto &search_graph, const auto &adjacency)
+        { enumerate_odd_holes_dfs(search_graph, adjacency, is_anti_hole_search, report_hole, limits); }
+    );
+    return;
+}
+
+std::vector<bool> cycle_vector_to_bool_vec(const std::vector<int> &vec, size_t vec_size)
+{
+    std::vector<bool> bool_vec(vec_size, false);
+
+    for (int i : vec)
+    {
+        bool_vec[i] = true;
+    }
+
+    return bool_vec;
+}
 
+template <typename Graph_View>
 std::unordered_map<std::vector<bool>, std::vector<int>> find_odd_holes(
-    const std::vector<std::vector<bool>> &graph_adj_mat, bool is_anti_hole_search, int termination_batch_size
+    const Graph_View &graph, bool is_anti_hole_search, int termination_batch_size
 )
 {
-
-    auto graph_adj_list = get_adj_list_from_adj_matrix(graph_adj_mat);
     std::unordered_map<std::vector<bool>, std::vector<int>> odd_holes;
+    auto report_hole = [&](const std::vector<int> &odd_hole)
+    {
+        auto cycle_vert_subset = cycle_vector_to_bool_vec(odd_hole, graph.size());
+        odd_holes.try_emplace(cycle_vert_subset, odd_hole);
+        return termination_batch_size != 0 &&
+               odd_holes.size() >= static_cast<size_t>(termination_batch_size);
+    };
+
+    Search_Limits limits;
+    enumerate_odd_holes_dfs(graph, is_anti_hole_search, report_hole, limits);
+    return odd_holes;
+}
+
+// State of the chordless cycle enumeration for a fixed root s and its two cycle neighbors u < w. The
+// path runs from u and is closed into a cycle when it reaches w.
+struct Chordless_Search
+{
+    int target;
+    int path_block;
+    int wanted_min_cycle_length;
+
+    // blocked[x] is the number of path vertices, other than the last one, adjacent to x. Extending the
+    // path with a blocked vertex would create a chord.
+    std::vector<int> blocked;
+    std::vector<bool> in_path;
+
+    // Scratch buffers for the reachability check
+    std::vector<bool> reaches_target;
+    std::vector<int> bfs_queue;
+};
+
+// A vertex can be on the path if it is in the block of the path and is not adjacent to the root,
+// except for the target which closes the cycle.
+template <typename Graph_View>
+bool is_chordless_candidate(
+    const Graph_View &graph,
+    const Suffix_Subgraph &suffix,
+    const Chordless_Search &search,
+    int root,
+    int x
+)
+{
+    return suffix.root_block[x] == search.path_block && (x == search.target || !graph.is_adjacent(root, x));
+}
+
+// Marks the vertices from which the target is reachable without touching the path or its
+// neighborhood. Every extension that passes this check ends in at least one chordless cycle, so each
+// step of the enumeration pays for itself with output.
+template <typename Graph_View, typename Adjacency>
+void mark_vertices_reaching_target(
+    const Graph_View &graph,
+    const Adjacency &adjacency,
+    const Suffix_Subgraph &suffix,
+    Chordless_Search &search,
+    int root
+)
+{
+    std::fill(search.reaches_target.begin(), search.reaches_target.end(), false);
+    search.bfs_queue.clear();
+    search.bfs_queue.push_back(search.target);
+    search.reaches_target[search.target] = true;
 
-    for (int i = 0; i < graph_adj_mat.size(); ++i)
+    for (size_t head = 0; head < search.bfs_queue.size(); ++head)
     {
-        std::vector<int> path_vector = {i};
-        path_vector.reserve(graph_adj_mat.size());
-        odd_hole_recursive(
-            graph_adj_mat, graph_adj_list, path_vector, odd_holes, is_anti_hole_search, termination_batch_size
-        );
+        for (auto y : adjacency.neighbors(search.bfs_queue[head]))
+        {
+            if (search.reaches_target[y] || search.in_path[y] || search.blocked[y] > 0 ||
+                !is_chordless_candidate(graph, suffix, search, root, y))
+                continue;
+            search.reaches_target[y] = true;
+            search.bfs_queue.push_back(y);
+        }
     }
+    return;
+}
+
+Chordless_Search init_chordless_search(int n, bool is_anti_hole_search)
+{
+    Chordless_Search search;
+    search.wanted_min_cycle_length = is_anti_hole_search ? 7 : 5;
+    search.blocked.assign(n, 0);
+    search.in_path.assign(n, false);
+    search.reaches_target.assign(n, false);
+    search.bfs_queue.reserve(n);
+    return search;
+}
+
+// report_hole is called with each odd hole found, as the vector of its vertices along the cycle
+template <typename Graph_View, typename Adjacency, typename Report_Hole>
+void chordless_cycle_recursive(
+    const Graph_View &graph,
+    const Adjacency &adjacency,
+    const Suffix_Subgraph &suffix,
+    Chordless_Search &search,
+    std::vector<int> &path_vector,
+    Report_Hole &report_hole
+)
+{
+    int root = path_vector[0];
+    int last_added_v = path_vector.back();
+
+    // The target is unblocked here, so if it is adjacent to the last vertex, closing the cycle is the
+    // only chordless continuation.
+    if (graph.is_adjacent(last_added_v, search.target))
+    {
+        int cycle_length = path_vector.size() + 1;
+        if (cycle_length % 2 == 1 && cycle_length >= search.wanted_min_cycle_length)
+        {
+            path_vector.push_back(search.target);
+            report_hole(path_vector);
+            path_vector.pop_back();
+        }
+        return;
+    }
+
+    std::vector<int> candidates;
+    for (auto x : adjacency.neighbors(last_added_v))
+    {
+        if (!search.in_path[x] && search.blocked[x] == 0 &&
+            is_chordless_candidate(graph, suffix, search, root, x))
+            candidates.push_back(x);
+    }
+    if (candidates.empty())
+        return;
+
+    // From now on last_added_v is an internal vertex, so its neighbors are blocked
+    for (auto y : adjacency.neighbors(last_added_v))
+        search.blocked[y]++;
+
+    mark_vertices_reaching_target(graph, adjacency, suffix, search, root);
+
+    // Reachability is computed once for all candidates. A candidate is extended only if one of its
+    // neighbors still reaches the target.
+    std::vector<int> extendable;
+    for (auto x : candidates)
+    {
+        for (auto y : adjacency.neighbors(x))
+        {
+            if (search.reaches_target[y])
+            {
+                extendable.push_back(x);
+                break;
+            }
+        }
+    }
+
+    for (auto x : extendable)
+    {
+        path_vector.push_back(x);
+        search.in_path[x] = true;
+        chordless_cycle_recursive(graph, adjacency, suffix, search, path_vector, report_hole);
+        search.in_path[x] = false;
+        path_vector.pop_back();
+    }
+
+    for (auto y : adjacency.neighbors(last_added_v))
+        search.blocked[y]--;
+    return;
+}
+
+// Enumerates the odd holes through root s, on the suffix subgraph of s, with the chordless cycle
+// algorithm of Uno and Satoh. A cycle is generated from its smallest vertex s and its two neighbors
+// u < w on the cycle, so each one is found exactly once and no deduplication is needed.
+template <typename Graph_View, typename Adjacency, typename Report_Hole>
+void search_root_chordless(
+    const Graph_View &graph,
+    const Adjacency &adjacency,
+    Suffix_Subgraph &suffix,
+    Chordless_Search &search,
+    int s,
+    Report_Hole &report_hole
+)
+{
+    if (!suffix.is_alive[s] || label_root_blocks(adjacency, suffix, s, search.wanted_min_cycle_length) <
+                                   search.wanted_min_cycle_length - 1)
+        return;
+
+    std::vector<int> path_vector;
+    path_vector.reserve(graph.size());
+
+    auto root_neighbors = adjacency.neighbors_after(s, s);
+    for (auto u_it = root_neighbors.begin(); u_it != root_neighbors.end(); ++u_it)
+    {
+        int u = *u_it;
+        if (suffix.root_block[u] == -1)
+            continue;
+
+        auto w_it = u_it;
+        for (++w_it; w_it != root_neighbors.end(); ++w_it)
+        {
+            int w = *w_it;
+            // u and w adjacent would close a triangle
+            if (suffix.root_block[w] != suffix.root_block[u] || graph.is_adjacent(u, w))
+                continue;
+
+            search.target = w;
+            search.path_block = suffix.root_block[u];
+
+            path_vector.assign({s, u});
+            search.in_path[s] = search.in_path[u] = true;
+
+            // The root is internal to the cycle, so its neighbors other than u and w are already
+            // excluded by is_chordless_candidate.
+            chordless_cycle_recursive(graph, adjacency, suffix, search, path_vector, report_hole);
+            search.in_path[s] = search.in_path[u] = false;
+        }
+    }
+    return;
+}
+
+template <typename Graph_View, typename Report_Hole>
+void enumerate_odd_holes_chordless(
+    const Graph_View &graph, bool is_anti_hole_search, Report_Hole &report_hole
+)
+{
+    run_search_on_adjacency(
+        graph,
+        [&](const auto &search_graph, const auto &adjacency)
+        {
+            int n = search_graph.size();
+            auto search = init_chordless_search(n, is_anti_hole_search);
+            auto suffix = init_suffix_subgraph(adjacency);
 
+            for (int s = 0; s < n; ++s)
+            {
+                search_root_chordless(search_graph, adjacency, suffix, search, s, report_hole);
+                delete_vertex_and_peel(adjacency, suffix, s);
+            }
+        }
+    );
+    return;
+}
+
+template <typename Graph_View>
+std::vector<std::vector<int>> find_odd_holes_chordless(
+    const Graph_View &graph, bool is_anti_hole_search
+)
+{
+    std::vector<std::vector<int>> odd_holes;
+    auto report_hole = [&odd_holes](const std::vector<int> &odd_hole) { odd_holes.push_back(odd_hole); };
+
+    enumerate_odd_holes_chordless(graph, is_anti_hole_search, report_hole);
     return odd_holes;
 }
 
-bool is_perfect(const std::vector<std::vector<bool>> &graph_adj_mat)
+// Counts the odd holes by cycle length, without storing them. Roots are handed out to the threads in
+// increasing order, so each thread keeps its own suffix subgraph and only ever deletes vertices from
+// it. Memory is O(n) per thread besides the graph.
+template <typename Graph_View, typename Adjacency>
+std::vector<unsigned long long> count_odd_holes_chordless(
+    const Graph_View &graph, const Adjacency &adjacency, bool is_anti_hole_search
+)
 {
+    int n = graph.size();
 
-    auto odd_holes = find_odd_holes(graph_adj_mat, false, 1);
-    if (odd_holes.size() > 0)
+    int n_threads = std::max(1, std::min<int>(std::thread::hardware_concurrency(), n));
+    std::vector<std::vector<unsigned long long>> thread_counts(n_threads, std::vector<unsigned long long>(n + 1, 0));
+    std::atomic<int> next_root = 0;
+
+    auto count_worker = [&](int thread_id)
+    {
+        auto &counts = thread_counts[thread_id];
+        auto report_hole = [&counts](const std::vector<int> &odd_hole) { counts[odd_hole.size()]++; };
+
+        auto search = init_chordless_search(n, is_anti_hole_search);
+        auto suffix = init_suffix_subgraph(adjacency);
+        int n_deleted = 0;
+
+        for (int s = next_root++; s < n; s = next_root++)
+        {
+            while (n_deleted < s)
+                delete_vertex_and_peel(adjacency, suffix, n_deleted++);
+            search_root_chordless(graph, adjacency, suffix, search, s, report_hole);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < n_threads; ++t)
+        threads.emplace_back(count_worker, t);
+    count_worker(0);
+    for (auto &thread : threads)
+        thread.join();
+
+    std::vector<unsigned long long> counts(n + 1, 0);
+    for (const auto &thread_count : thread_counts)
+    {
+        for (int length = 0; length <= n; ++length)
+            counts[length] += thread_count[length];
+    }
+    return counts;
+}
+
+template <typename Graph_View>
+std::vector<unsigned long long> count_odd_holes_chordless(const Graph_View &graph, bool is_anti_hole_search)
+{
+    std::vector<unsigned long long> counts;
+    run_search_on_adjacency(
+        graph,
+        [&](const auto &search_graph, const auto &adjacency)
+        { counts = count_odd_holes_chordless(search_graph, adjacency, is_anti_hole_search); }
+    );
+    return counts;
+}
+
+// Enumerates each odd hole exactly once with the given engine, as a cycle starting from its smallest
+// vertex s and leaving s towards its smaller neighbor on the cycle.
+template <typename Graph_View, typename Report_Hole>
+void enumerate_odd_holes(
+    const Graph_View &graph,
+    bool is_anti_hole_search,
+    Hole_Enumeration_Engine engine,
+    Report_Hole &report_hole
+)
+{
+    if (engine == Hole_Enumeration_Engine::chordless_cycles)
+    {
+        enumerate_odd_holes_chordless(graph, is_anti_hole_search, report_hole);
+        return;
+    }
+
+    // The DFS finds each hole in both directions, only one of them is kept
+    auto report_one_direction = [&report_hole](const std::vector<int> &odd_hole)
+    {
+        if (odd_hole[1] < odd_hole.back())
+            report_hole(odd_hole);
+        return false;
+    };
+    Search_Limits limits;
+    enumerate_odd_holes_dfs(graph, is_anti_hole_search, report_one_direction, limits);
+    return;
+}
+
+// Stops the search at the first odd hole, which is stored in odd_hole. If the search is aborted on its
+// limits, false is returned and limits.is_aborted is set.
+template <typename Graph_View>
+bool find_first_odd_hole(
+    const Graph_View &graph, bool is_anti_hole_search, std::vector<int> &odd_hole, Search_Limits &limits
+)
+{
+    bool is_found = false;
+    auto report_hole = [&](const std::vector<int> &found_hole)
+    {
+        odd_hole = found_hole;
+        is_found = true;
+        return true;
+    };
+    enumerate_odd_holes_dfs(graph, is_anti_hole_search, report_hole, limits);
+    return is_found;
+}
+
+// Odd hole or odd antihole that shows a graph is not perfect, as its vertices along the cycle in the
+// graph, or in its complement if is_antihole is set
+struct Odd_Hole_Witness
+{
+    std::vector<int> cycle;
+    bool is_antihole = false;
+};
+
+// The result is only meaningful if limits.is_aborted is not set. If the graph is not perfect, the odd
+// hole or odd antihole found is stored in witness.
+template <typename Graph_View>
+bool is_perfect_dfs(const Graph_View &graph, Search_Limits &limits, Odd_Hole_Witness &witness)
+{
+    witness.is_antihole = false;
+    if (find_first_odd_hole(graph, false, witness.cycle, limits) || limits.is_aborted)
+    {
+        return false;
+    }
+    witness.is_antihole = true;
+    if (find_first_odd_hole(Complement_View<Graph_View>{graph}, true, witness.cycle, limits))
     {
         return false;
     }
+    return true;
+}
+
+template <typename Graph_View>
+bool count_holes_in_view(
+    const Graph_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+)
+{
+    odd_hole_counts = count_odd_holes_chordless(graph, false);
+    odd_antihole_counts = count_odd_holes_chordless(Complement_View<Graph_View>{graph}, true);
+
+    for (size_t length = 0; length < odd_hole_counts.size(); ++length)
+    {
+        if (odd_hole_counts[length] > 0 || odd_antihole_counts[length] > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Graph_View>
+bool write_holes_in_view(const Graph_View &graph, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine)
+{
+    auto report_hole = [&hole_writer](const std::vector<int> &odd_hole) { hole_writer.write_hole(odd_hole); };
+
+    hole_writer.begin_holes(false);
+    enumerate_odd_holes(graph, false, engine, report_hole);
+    auto n_odd_holes = hole_writer.end_holes();
 
-    auto complement_graph = get_complement_of_graph(graph_adj_mat);
-    auto odd_anti_holes = find_odd_holes(complement_graph, true, 1);
-    if (odd_anti_holes.size() > 0)
+    hole_writer.begin_holes(true);
+    enumerate_odd_holes(Complement_View<Graph_View>{graph}, true, engine, report_hole);
+    auto n_odd_antiholes = hole_writer.end_holes();
+
+    if ((n_odd_antiholes > 0) || (n_odd_holes > 0))
     {
         return false;
     }
     return true;
 }
 
-bool is_perfect_log_holes(const std::vector<std::vector<bool>> &graph_adj_mat, std::string &log)
+// Induced subgraph of a view on the given vertices, or its complement. Vertex i of the view is vertices[i]
+// of the graph. Both sides of every step of the decomposition are views of this type on the input graph,
+// so no matrix is copied and the type does not nest as the decomposition alternates.
+template <typename Graph_View>
+struct Decomposition_View
+{
+    const Graph_View *graph;
+    const std::vector<int> *vertices;
+    bool is_complement;
+
+    int size() const
+    {
+        return vertices->size();
+    }
+    bool is_adjacent(int i, int j) const
+    {
+        return i != j && (graph->is_adjacent((*vertices)[i], (*vertices)[j]) != is_complement);
+    }
+    void append_neighbors(int v, std::vector<int> &neighbors) const
+    {
+        for (int j = 0; j < size(); ++j)
+        {
+            if (is_adjacent(v, j))
+                neighbors.push_back(j);
+        }
+    }
+};
+
+template <typename Adjacency>
+bool is_bipartite(const Adjacency &adjacency)
+{
+    int n = adjacency.size();
+    std::vector<int> color(n, -1);
+    std::vector<int> queue;
+    for (int source = 0; source < n; ++source)
+    {
+        if (color[source] != -1)
+            continue;
+        color[source] = 0;
+        queue.assign(1, source);
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            int v = queue[head];
+            for (auto u : adjacency.neighbors(v))
+            {
+                if (color[u] == -1)
+                {
+                    color[u] = 1 - color[v];
+                    queue.push_back(u);
+                }
+                else if (color[u] == color[v])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool is_triangle_free(const Packed_Bits_View &graph)
+{
+    Bit_Rows_Adjacency adjacency{graph, false};
+    for (int v = 0; v < graph.size(); ++v)
+    {
+        for (auto u : adjacency.neighbors_after(v, v))
+        {
+            for (size_t word_id = 0; word_id < graph.row_stride; ++word_id)
+            {
+                if (graph.bits[v * graph.row_stride + word_id] & graph.bits[u * graph.row_stride + word_id])
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Checks a graph that has no clique cutset, nor does its complement. Two exact tests in polynomial time
+// come first: a bipartite graph has no odd hole, and an odd antihole of length at least 7 contains a
+// triangle, so a triangle-free graph or a graph with a bipartite complement has none. The DFS only runs
+// on the sides these tests do not settle.
+template <typename Graph_View>
+bool is_perfect_prime_graph(
+    const Decomposition_View<Graph_View> &graph, Search_Limits &limits, Odd_Hole_Witness &witness
+)
+{
+    int n = graph.size();
+    size_t row_stride = (n + 63) / 64;
+    std::vector<uint64_t> rows(n * row_stride, 0);
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            if (graph.is_adjacent(i, j))
+                rows[i * row_stride + j / 64] |= uint64_t(1) << (j % 64);
+        }
+    }
+    Packed_Bits_View packed_graph{rows.data(), n, row_stride};
+
+    bool may_have_odd_hole = !is_bipartite(Bit_Rows_Adjacency{packed_graph, false});
+    bool may_have_odd_antihole =
+        !is_triangle_free(packed_graph) && !is_bipartite(Bit_Rows_Adjacency{packed_graph, true});
+
+    // An odd hole of the complement side is an odd antihole of the graph, and the other way around
+    bool is_found = false;
+    if (may_have_odd_hole)
+    {
+        is_found = find_first_odd_hole(packed_graph, false, witness.cycle, limits);
+        witness.is_antihole = graph.is_complement;
+        if (limits.is_aborted)
+            return false;
+    }
+    if (!is_found && may_have_odd_antihole)
+    {
+        Complement_View<Packed_Bits_View> complement_graph{packed_graph};
+        is_found = find_first_odd_hole(complement_graph, true, witness.cycle, limits);
+        witness.is_antihole = !graph.is_complement;
+    }
+    if (!is_found)
+        return true;
+
+    for (auto &v : witness.cycle)
+        v = (*graph.vertices)[v];
+    return false;
+}
+
+// Odd holes and odd antiholes have no clique cutset, so each one lies within an atom of the clique
+// cutset decomposition of G, and G is perfect if and only if all of its atoms are. The same holds for
+// the complement, so the decomposition alternates between G and its complement until neither side
+// splits, and only such prime graphs are searched. The decomposition takes polynomial time, but the
+// search on prime graphs does not. The subgraph on vertices is checked, complemented if is_complement
+// is set. is_atom tells that it is already known to have no clique cutset. The result is only
+// meaningful if limits.is_aborted is not set. The witness is in the vertices of graph.
+template <typename Graph_View>
+bool is_perfect_by_decomposition(
+    const Graph_View &graph,
+    const std::vector<int> &vertices,
+    bool is_complement,
+    bool is_atom,
+    Search_Limits &limits,
+    Odd_Hole_Witness &witness
+)
+{
+    if (limits.stop_flag != nullptr && limits.stop_flag->load(std::memory_order_relaxed))
+        limits.is_aborted = true;
+
+    // Graphs with less than 5 vertices have neither odd holes nor odd antiholes
+    if (vertices.size() < 5 || limits.is_aborted)
+        return true;
+
+    Decomposition_View<Graph_View> side{&graph, &vertices, is_complement};
+    Decomposition_View<Graph_View> other_side{&graph, &vertices, !is_complement};
+
+    for (const auto &split_side : {side, other_side})
+    {
+        if (is_atom && split_side.is_complement == is_complement)
+            continue;
+
+        auto atoms = get_clique_cutset_atoms(get_adj_list_from_view(split_side));
+        if (atoms.size() == 1)
+            continue;
+
+        for (auto &atom : atoms)
+        {
+            for (auto &v : atom)
+                v = vertices[v];
+            if (!is_perfect_by_decomposition(graph, atom, split_side.is_complement, true, limits, witness))
+                return false;
+        }
+        return true;
+    }
+
+    return is_perfect_prime_graph(side, limits, witness);
+}
+
+template <typename Graph_View>
+bool is_perfect_by_decomposition(const Graph_View &graph, Search_Limits &limits, Odd_Hole_Witness &witness)
+{
+    std::vector<int> vertices(graph.size());
+    for (int v = 0; v < graph.size(); ++v)
+        vertices[v] = v;
+    return is_perfect_by_decomposition(graph, vertices, false, false, limits, witness);
+}
+
+// Runs the DFS and the decomposition on two threads and returns the verdict of the first one to finish.
+// The other one is stopped.
+template <typename Graph_View>
+bool is_perfect_race(const Graph_View &graph, Odd_Hole_Witness &witness)
+{
+    std::atomic<bool> stop_flag = false;
+    std::atomic<int> winner = -1;
+    bool results[2] = {true, true};
+    Odd_Hole_Witness witnesses[2];
+
+    auto run_engine = [&](int engine_id)
+    {
+        Search_Limits limits;
+        limits.stop_flag = &stop_flag;
+        bool result = (engine_id == 0) ? is_perfect_dfs(graph, limits, witnesses[engine_id])
+                                       : is_perfect_by_decomposition(graph, limits, witnesses[engine_id]);
+        if (limits.is_aborted)
+            return;
+
+        results[engine_id] = result;
+        int no_winner = -1;
+        if (winner.compare_exchange_strong(no_winner, engine_id))
+            stop_flag = true;
+    };
+
+    std::thread decomposition_thread(run_engine, 1);
+    run_engine(0);
+    decomposition_thread.join();
+
+    witness = std::move(witnesses[winner]);
+    return results[winner];
+}
+
+// Cost model of the automatic engine. Small graphs go to the DFS directly. Otherwise the DFS is probed
+// with a work budget of about the cost of decomposing G and its complement once, O(n (n + m)) for the
+// sparser side. Most non-perfect graphs and easy perfect graphs are settled by the probe. If it runs
+// out, the search space is large and the decomposition is used, which only searches prime atoms.
+const int automatic_dfs_max_order = 32;
+const unsigned long long automatic_probe_budget_factor = 1;
+
+template <typename Graph_View>
+bool is_perfect_automatic(const Graph_View &graph, Odd_Hole_Witness &witness)
+{
+    unsigned long long n = graph.size();
+
+    Search_Limits probe_limits;
+    if (n > automatic_dfs_max_order)
+    {
+        unsigned long long n_edges = 0;
+        std::vector<int> neighbors;
+        for (int v = 0; v < graph.size(); ++v)
+        {
+            neighbors.clear();
+            graph.append_neighbors(v, neighbors);
+            n_edges += neighbors.size();
+        }
+        n_edges /= 2;
+        unsigned long long n_sparser_side_edges = std::min(n_edges, n * (n - 1) / 2 - n_edges);
+        probe_limits.work_budget = automatic_probe_budget_factor * n * (n + n_sparser_side_edges);
+    }
+
+    bool result = is_perfect_dfs(graph, probe_limits, witness);
+    if (!probe_limits.is_aborted)
+        return result;
+
+    Search_Limits limits;
+    return is_perfect_by_decomposition(graph, limits, witness);
+}
+
+// If the graph is not perfect, the odd hole or odd antihole that settled it is stored in witness
+template <typename Graph_View>
+bool is_perfect_in_view(const Graph_View &graph, Recognition_Engine engine, Odd_Hole_Witness &witness)
+{
+    switch (engine)
+    {
+    case Recognition_Engine::path_dfs:
+    {
+        Search_Limits limits;
+        return is_perfect_dfs(graph, limits, witness);
+    }
+    case Recognition_Engine::decomposition:
+    {
+        Search_Limits limits;
+        return is_perfect_by_decomposition(graph, limits, witness);
+    }
+    case Recognition_Engine::race:
+        return is_perfect_race(graph, witness);
+    case Recognition_Engine::automatic:
+        break;
+    }
+    return is_perfect_automatic(graph, witness);
+}
+
+template <typename Graph_View>
+bool is_perfect_in_view(const Graph_View &graph, Recognition_Engine engine)
+{
+    Odd_Hole_Witness witness;
+    return is_perfect_in_view(graph, engine, witness);
+}
+
+void log_odd_hole_header(size_t n_odd_holes, std::string &log, bool is_anti)
+{
+    if (!is_anti)
+        log += "Number of odd holes: " + std::to_string(n_odd_holes) + "\n";
+    else
+        log += "Number of odd antiholes: " + std::to_string(n_odd_holes) + "\n";
+
+    if (n_odd_holes > 0)
+    {
+        if (is_anti)
+            log += "Printing odd holes:\n";
+        else
+            log += "Printing odd antiholes:\n";
+    }
+    return;
+}
+
+void log_odd_hole_cycle(const std::vector<int> &cycle, std::string &log)
+{
+    for (const auto &v : cycle)
+    {
+        log += std::to_string(v) + ", ";
+    }
+    log += "\n";
+    return;
+}
+
+void log_odd_holes(
+    const std::unordered_map<std::vector<bool>, std::vector<int>> &odd_holes, std::string &log, bool is_anti
+)
+{
+    log_odd_hole_header(odd_holes.size(), log, is_anti);
+    for (const auto &[key, cycle] : odd_holes)
+    {
+        log_odd_hole_cycle(cycle, log);
+    }
+    return;
+}
+
+void log_odd_holes(const std::vector<std::vector<int>> &odd_holes, std::string &log, bool is_anti)
+{
+    log_odd_hole_header(odd_holes.size(), log, is_anti);
+    for (const auto &cycle : odd_holes)
+    {
+        log_odd_hole_cycle(cycle, log);
+    }
+    return;
+}
+
+} // namespace
+
+bool is_perfect(const std::vector<std::vector<bool>> &graph_adj_mat, Recognition_Engine engine)
+{
+    return is_perfect_in_view(Adjacency_Matrix_View{&graph_adj_mat}, engine);
+}
+
+bool is_perfect(const Packed_Bits_View &graph, Recognition_Engine engine)
+{
+    return is_perfect_in_view(graph, engine);
+}
+
+bool is_perfect(const Byte_Matrix_View &graph, Recognition_Engine engine)
 {
-    auto odd_holes = find_odd_holes(graph_adj_mat, false, 0);
-    auto complement_graph = get_complement_of_graph(graph_adj_mat);
-    auto odd_antiholes = find_odd_holes(complement_graph, true, 0);
+    return is_perfect_in_view(graph, engine);
+}
+
+bool is_perfect(const Csr_View &graph, Recognition_Engine engine)
+{
+    return is_perfect_in_view(graph, engine);
+}
 
-    log_odd_holes(odd_holes, log, false);
-    log_odd_holes(odd_antiholes, log, true);
-    if ((odd_antiholes.size() > 0) || (odd_holes.size() > 0))
+bool is_perfect_log_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat, std::string &log, Hole_Enumeration_Engine engine
+)
+{
+    Adjacency_Matrix_View graph{&graph_adj_mat};
+    Complement_View<Adjacency_Matrix_View> complement_graph{graph};
+
+    size_t n_odd_holes, n_odd_antiholes;
+    if (engine == Hole_Enumeration_Engine::chordless_cycles)
+    {
+        auto odd_holes = find_odd_holes_chordless(graph, false);
+        auto odd_antiholes = find_odd_holes_chordless(complement_graph, true);
+        log_odd_holes(odd_holes, log, false);
+        log_odd_holes(odd_antiholes, log, true);
+        n_odd_holes = odd_holes.size();
+        n_odd_antiholes = odd_antiholes.size();
+    }
+    else
+    {
+        auto odd_holes = find_odd_holes(graph, false, 0);
+        auto odd_antiholes = find_odd_holes(complement_graph, true, 0);
+        log_odd_holes(odd_holes, log, false);
+        log_odd_holes(odd_antiholes, log, true);
+        n_odd_holes = odd_holes.size();
+        n_odd_antiholes = odd_antiholes.size();
+    }
+
+    if ((n_odd_antiholes > 0) || (n_odd_holes > 0))
     {
         return false;
     }
     return true;
+}
+
+bool is_perfect_count_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+)
+{
+    return count_holes_in_view(Adjacency_Matrix_View{&graph_adj_mat}, odd_hole_counts, odd_antihole_counts);
+}
+
+bool is_perfect_count_holes(
+    const Packed_Bits_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+)
+{
+    return count_holes_in_view(graph, odd_hole_counts, odd_antihole_counts);
+}
+
+bool is_perfect_count_holes(
+    const Byte_Matrix_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+)
+{
+    return count_holes_in_view(graph, odd_hole_counts, odd_antihole_counts);
+}
+
+bool is_perfect_count_holes(
+    const Csr_View &graph,
+    std::vector<unsigned long long> &odd_hole_counts,
+    std::vector<unsigned long long> &odd_antihole_counts
+)
+{
+    return count_holes_in_view(graph, odd_hole_counts, odd_antihole_counts);
+}
+
+bool is_perfect_write_holes(
+    const std::vector<std::vector<bool>> &graph_adj_mat, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine
+)
+{
+    return write_holes_in_view(Adjacency_Matrix_View{&graph_adj_mat}, hole_writer, engine);
+}
+
+bool is_perfect_write_holes(
+    const Packed_Bits_View &graph, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine
+)
+{
+    return write_holes_in_view(graph, hole_writer, engine);
+}
+
+bool is_perfect_write_holes(
+    const Byte_Matrix_View &graph, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine
+)
+{
+    return write_holes_in_view(graph, hole_writer, engine);
+}
+
+bool is_perfect_write_holes(const Csr_View &graph, Hole_Writer &hole_writer, Hole_Enumeration_Engine engine)
+{
+    return write_holes_in_view(graph, hole_writer, engine);
+}
+
+bool is_perfect(
+    const Packed_Bits_View &graph, std::vector<int> &witness, bool &is_antihole, Recognition_Engine engine
+)
+{
+    Odd_Hole_Witness odd_hole_witness;
+    bool result = is_perfect_in_view(graph, engine, odd_hole_witness);
+    witness = std::move(odd_hole_witness.cycle);
+    is_antihole = odd_hole_witness.is_antihole;
+    return result;
 }
\ No newline at end of file
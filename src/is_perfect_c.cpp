@@ -0,0 +1,131 @@
+// is_perfect_c.cpp
+// C interface of the is_perfect library
+
+#include "is_perfect_c.h"
+#include "is_perfect_algo.h"
+
+#include <new>
+
+namespace
+{
+
+// Checks the description and calls solve with the matching view. Exceptions do not cross the C
+// boundary, they are turned into status codes.
+template <typename Solve>
+is_perfect_status dispatch_graph_view(const is_perfect_graph *graph, Solve solve)
+{
+    if (graph == nullptr || graph->n < 0)
+        return IS_PERFECT_INVALID_ARGUMENT;
+
+    try
+    {
+        switch (graph->format)
+        {
+        case IS_PERFECT_PACKED_BITS:
+            if ((graph->data == nullptr && graph->n > 0) || graph->row_stride * 64 < size_t(graph->n))
+                return IS_PERFECT_INVALID_ARGUMENT;
+            solve(Packed_Bits_View{static_cast<const uint64_t *>(graph->data), graph->n, graph->row_stride});
+            return IS_PERFECT_OK;
+        case IS_PERFECT_BYTE_MATRIX:
+            if ((graph->data == nullptr && graph->n > 0) || graph->row_stride < size_t(graph->n))
+                return IS_PERFECT_INVALID_ARGUMENT;
+            solve(Byte_Matrix_View{static_cast<const uint8_t *>(graph->data), graph->n, graph->row_stride});
+            return IS_PERFECT_OK;
+        case IS_PERFECT_CSR:
+            if (graph->row_offsets == nullptr || (graph->column_indices == nullptr && graph->row_offsets[graph->n] > 0))
+                return IS_PERFECT_INVALID_ARGUMENT;
+            solve(Csr_View{graph->row_offsets, graph->column_indices, graph->n});
+            return IS_PERFECT_OK;
+        }
+        return IS_PERFECT_INVALID_ARGUMENT;
+    }
+    catch (const std::bad_alloc &)
+    {
+        return IS_PERFECT_OUT_OF_MEMORY;
+    }
+    catch (...)
+    {
+        return IS_PERFECT_INTERNAL_ERROR;
+    }
+}
+
+} // namespace
+
+extern "C" int is_perfect_api_version(void)
+{
+    return IS_PERFECT_API_VERSION;
+}
+
+extern "C" is_perfect_status is_perfect_check(const is_perfect_graph *graph, int *result)
+{
+    return is_perfect_check_with_engine(graph, IS_PERFECT_ENGINE_AUTOMATIC, result);
+}
+
+extern "C" is_perfect_status is_perfect_check_with_engine(
+    const is_perfect_graph *graph, is_perfect_engine engine, int *result
+)
+{
+    if (result == nullptr)
+        return IS_PERFECT_INVALID_ARGUMENT;
+
+    Recognition_Engine recognition_engine;
+    switch (engine)
+    {
+    case IS_PERFECT_ENGINE_AUTOMATIC:
+        recognition_engine = Recognition_Engine::automatic;
+        break;
+    case IS_PERFECT_ENGINE_PATH_DFS:
+        recognition_engine = Recognition_Engine::path_dfs;
+        break;
+    case IS_PERFECT_ENGINE_DECOMPOSITION:
+        recognition_engine = Recognition_Engine::decomposition;
+        break;
+    case IS_PERFECT_ENGINE_RACE:
+        recognition_engine = Recognition_Engine::race;
+        break;
+    default:
+        return IS_PERFECT_INVALID_ARGUMENT;
+    }
+
+    return dispatch_graph_view(
+        graph, [&](const auto &graph_view) { *result = is_perfect(graph_view, recognition_engine); }
+    );
+}
+
+extern "C" is_perfect_status is_perfect_count_holes_by_length(
+    const is_perfect_graph *graph, uint64_t *odd_hole_counts, uint64_t *odd_antihole_counts, int *result
+)
+{
+    if (odd_hole_counts == nullptr || odd_antihole_counts == nullptr || result == nullptr)
+        return IS_PERFECT_INVALID_ARGUMENT;
+
+    return dispatch_graph_view(
+        graph,
+        [&](const auto &graph_view)
+        {
+            std::vector<unsigned long long> hole_counts, antihole_counts;
+            *result = is_perfect_count_holes(graph_view, hole_counts, antihole_counts);
+            for (size_t length = 0; length < hole_counts.size(); ++length)
+            {
+                odd_hole_counts[length] = hole_counts[length];
+                odd_antihole_counts[length] = antihole_counts[length];
+            }
+        }
+    );
+}
+
+extern "C" const char *is_perfect_status_string(is_perfect_status status)
+{
+    switch (status)
+    {
+    case IS_PERFECT_OK:
+        return "ok";
+    case IS_PERFECT_INVALID_ARGUMENT:
+        return "invalid argument";
+    case IS_PERFECT_OUT_OF_MEMORY:
+        return "out of memory";
+    case IS_PERFECT_INTERNAL_ERROR:
+        return "internal error";
+    }
+    return "unknown status";
+}
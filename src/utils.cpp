@@ -80,18 +80,6 @@ std::string cycle_vector_to_string(std::vector<int> vec)
     return cycle_string;
 }
 
-std::vector<bool> cycle_vector_to_bool_vec(const std::vector<int> &vec, size_t vec_size)
-{
-    std::vector<bool> bool_vec(vec_size, false);
-
-    for (int i : vec)
-    {
-        bool_vec[i] = true;
-    }
-
-    return bool_vec;
-}
-
 std::vector<std::vector<int>> get_adj_list_from_adj_matrix(const std::vector<std::vector<bool>> &graph)
 {
     int n = graph.size();
@@ -142,29 +130,24 @@ bool path_has_valid_graph_extension(std::string path)
     return false;
 };
 
-void log_odd_holes(
-    const std::unordered_map<std::vector<bool>, std::vector<int>> &odd_holes, std::string &log, bool is_anti
-)
+void log_odd_hole_counts(const std::vector<unsigned long long> &counts_by_length, std::string &log, bool is_anti)
 {
+    unsigned long long n_odd_holes = 0;
+    for (const auto &count : counts_by_length)
+    {
+        n_odd_holes += count;
+    }
+
     if (!is_anti)
-        log += "Number of odd holes: " + std::to_string(odd_holes.size()) + "\n";
+        log += "Number of odd holes: " + std::to_string(n_odd_holes) + "\n";
     else
-        log += "Number of odd antiholes: " + std::to_string(odd_holes.size()) + "\n";
+        log += "Number of odd antiholes: " + std::to_string(n_odd_holes) + "\n";
 
-    if (!odd_holes.empty())
+    for (size_t length = 0; length < counts_by_length.size(); ++length)
     {
-        if (is_anti)
-            log += "Printing odd holes:\n";
-        else
-            log += "Printing odd antiholes:\n";
-
-        for (const auto &[key, cycle] : odd_holes)
+        if (counts_by_length[length] > 0)
         {
-            for (const auto &v : cycle)
-            {
-                log += std::to_string(v) + ", ";
-            }
-            log += "\n";
+            log += "  Length " + std::to_string(length) + ": " + std::to_string(counts_by_length[length]) + "\n";
         }
     }
     return;